@@ -282,6 +282,8 @@ UHoudiniAssetComponent::UHoudiniAssetComponent( const FObjectInitializer & Objec
     HoudiniAssetComponentMaterials = nullptr;
 #if WITH_EDITOR
     CopiedHoudiniComponent = nullptr;
+    PreviewMeshBuildTime = 0.0;
+    PendingComponentCount = 0;
 #endif
     AssetId = -1;
     GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
@@ -337,6 +339,7 @@ UHoudiniAssetComponent::UHoudiniAssetComponent( const FObjectInitializer & Objec
     bGeneratedUseMaximumStreamingTexelRatio = false;
     GeneratedStreamingDistanceMultiplier = 1.0f;
     GeneratedDistanceFieldResolutionScale = 0.0f;
+    bGeneratedUsePreviewMeshBuild = false;
 
     bNeedToUpdateNavigationSystem = false;
 
@@ -398,6 +401,17 @@ UHoudiniAssetComponent::AddReferencedObjects( UObject * InThis, FReferenceCollec
                 Collector.AddReferencedObject( StaticMesh, InThis );
         }
 
+#if WITH_EDITOR
+        // Back buffers have no component, they are only kept alive by us.
+        for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator
+            Iter( HoudiniAssetComponent->StaticMeshBackBuffers ); Iter; ++Iter )
+        {
+            UStaticMesh * StaticMesh = Iter.Value();
+            if ( StaticMesh )
+                Collector.AddReferencedObject( StaticMesh, InThis );
+        }
+#endif
+
         // Add references to all static meshes and their static mesh components.
         for ( TMap< UStaticMesh *, UStaticMeshComponent * >::TIterator
             Iter( HoudiniAssetComponent->StaticMeshComponents ); Iter; ++Iter )
@@ -504,6 +518,15 @@ UHoudiniAssetComponent::SetHoudiniAsset( UHoudiniAsset * InHoudiniAsset )
     // Clear all inputs.
     ClearInputs();
 
+#if WITH_EDITOR
+    // Foliage written by the previous asset goes away with its instancers.
+    for ( UHoudiniAssetInstanceInput * InstanceInput : InstanceInputs )
+    {
+        if ( InstanceInput )
+            InstanceInput->ClearFoliageInstances();
+    }
+#endif
+
     // Clear all instance inputs.
     ClearInstanceInputs();
 
@@ -515,6 +538,9 @@ UHoudiniAssetComponent::SetHoudiniAsset( UHoudiniAsset * InHoudiniAsset )
 
     // Set Houdini logo to be default geometry.
     ReleaseObjectGeoPartResources( StaticMeshes );
+#if WITH_EDITOR
+    ReleaseObjectGeoPartResources( StaticMeshBackBuffers, true, true );
+#endif
     StaticMeshes.Empty();
     StaticMeshComponents.Empty();
     CreateStaticMeshHoudiniLogoResource( StaticMeshes );
@@ -661,6 +687,27 @@ UHoudiniAssetComponent::CreateObjectGeoPartResources( TMap< FHoudiniGeoPartObjec
     TArray< FHoudiniGeoPartObject > FoundCurves;
     TMap< FHoudiniGeoPartObject, UStaticMesh* > StaleParts;
 
+    // Meshes used by several parts are shared between identical parts. They are rendered by a single instanced
+    // component, with one instance per visible part.
+    TMap< UStaticMesh *, int32 > StaticMeshPartCounts;
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( StaticMeshMap ); Iter; ++Iter )
+    {
+        if ( Iter.Value() )
+            StaticMeshPartCounts.FindOrAdd( Iter.Value() )++;
+    }
+
+    TMap< UStaticMesh *, TArray< FTransform > > SharedStaticMeshInstances;
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( StaticMeshMap ); Iter; ++Iter )
+    {
+        const FHoudiniGeoPartObject & HoudiniGeoPartObject = Iter.Key();
+        if ( !Iter.Value() || StaticMeshPartCounts[ Iter.Value() ] < 2 )
+            continue;
+
+        TArray< FTransform > & InstanceTransforms = SharedStaticMeshInstances.FindOrAdd( Iter.Value() );
+        if ( HoudiniGeoPartObject.IsVisible() && !HoudiniGeoPartObject.IsCollidable() )
+            InstanceTransforms.Add( HoudiniGeoPartObject.TransformMatrix );
+    }
+
     for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( StaticMeshMap ); Iter; ++Iter )
     {
         const FHoudiniGeoPartObject HoudiniGeoPartObject = Iter.Key();
@@ -690,9 +737,29 @@ UHoudiniAssetComponent::CreateObjectGeoPartResources( TMap< FHoudiniGeoPartObjec
                 continue;
             }
 
+            if ( StaticMesh && StaticMeshPartCounts[ StaticMesh ] > 1 )
+            {
+                // The instanced component of a shared mesh is set up once, for all of its parts.
+                TArray< FTransform > * InstanceTransforms = SharedStaticMeshInstances.Find( StaticMesh );
+                if ( InstanceTransforms )
+                {
+                    CreateSharedStaticMeshComponent( StaticMesh, *InstanceTransforms );
+                    SharedStaticMeshInstances.Remove( StaticMesh );
+                }
+
+                continue;
+            }
+
             UStaticMeshComponent * StaticMeshComponent = nullptr;
             UStaticMeshComponent * FoundStaticMeshComponent = LocateStaticMeshComponent( StaticMesh );
 
+            if ( FoundStaticMeshComponent && FoundStaticMeshComponent->IsA< UInstancedStaticMeshComponent >() )
+            {
+                // This mesh is no longer shared, it needs a regular component again.
+                RemoveStaticMeshComponent( StaticMesh );
+                FoundStaticMeshComponent = nullptr;
+            }
+
             if ( FoundStaticMeshComponent )
             {
                 StaticMeshComponent = FoundStaticMeshComponent;
@@ -707,56 +774,11 @@ UHoudiniAssetComponent::CreateObjectGeoPartResources( TMap< FHoudiniGeoPartObjec
             else if ( HoudiniGeoPartObject.IsVisible() )
             {
                 // Create necessary component.
-                StaticMeshComponent = NewObject< UStaticMeshComponent >(
-                    GetOwner(), UStaticMeshComponent::StaticClass(),
-                    NAME_None, RF_Transactional );
-
-                // Attach created static mesh component to our Houdini component.
-                StaticMeshComponent->AttachToComponent( this, FAttachmentTransformRules::KeepRelativeTransform );
-
-                StaticMeshComponent->SetStaticMesh( StaticMesh );
-                StaticMeshComponent->SetVisibility( true );
-                StaticMeshComponent->SetMobility( Mobility );
-                StaticMeshComponent->RegisterComponent();
-
-                // Add to the map of components.
-                StaticMeshComponents.Add( StaticMesh, StaticMeshComponent );
+                StaticMeshComponent = CreateObjectGeoPartComponent( StaticMesh );
             }
 
             if ( StaticMeshComponent )
-            { 
-                // If this is a collision geo, we need to make it invisible.
-                if (HoudiniGeoPartObject.IsCollidable())
-                {
-                    StaticMeshComponent->SetVisibility( false );
-                    StaticMeshComponent->SetHiddenInGame( true );                                                                     
-                    StaticMeshComponent->SetCollisionProfileName( FName( TEXT( "InvisibleWall" ) ) );
-                }
-                else
-                {
-                    // Visibility may have changed so we still need to update it
-                    StaticMeshComponent->SetVisibility( HoudiniGeoPartObject.IsVisible() );
-                    StaticMeshComponent->SetHiddenInGame( !HoudiniGeoPartObject.IsVisible() );
-                }
-
-                // And we will need to update the navmesh later
-                if( HoudiniGeoPartObject.IsCollidable() || HoudiniGeoPartObject.IsRenderCollidable() )
-                    bNeedToUpdateNavigationSystem = true;
-
-                // Transform the component by transformation provided by HAPI.
-                StaticMeshComponent->SetRelativeTransform( HoudiniGeoPartObject.TransformMatrix );
-
-                // If the static mesh had sockets, we can assign the desired actor to them now
-                int32 NumberOfSockets = StaticMesh == nullptr ? 0 : StaticMesh->Sockets.Num();
-                for( int32 nSocket = 0; nSocket < NumberOfSockets; nSocket++ )
-                {
-                    UStaticMeshSocket* MeshSocket = StaticMesh->Sockets[ nSocket ];
-                    if ( MeshSocket && ( MeshSocket->Tag.IsEmpty() ) )
-                        continue;
-
-                    FHoudiniEngineUtils::AddActorsToMeshSocket( StaticMesh->Sockets[nSocket], StaticMeshComponent );
-                }
-            }
+                UpdateObjectGeoPartComponent( HoudiniGeoPartObject, StaticMesh, StaticMeshComponent );
         }
     }
 
@@ -787,16 +809,158 @@ UHoudiniAssetComponent::CreateObjectGeoPartResources( TMap< FHoudiniGeoPartObjec
     CleanUpAttachedStaticMeshComponents();
 }
 
+UStaticMeshComponent *
+UHoudiniAssetComponent::CreateObjectGeoPartComponent( UStaticMesh * StaticMesh )
+{
+    UStaticMeshComponent * StaticMeshComponent = NewObject< UStaticMeshComponent >(
+        GetOwner(), UStaticMeshComponent::StaticClass(),
+        NAME_None, RF_Transactional );
+
+    // Attach created static mesh component to our Houdini component.
+    StaticMeshComponent->AttachToComponent( this, FAttachmentTransformRules::KeepRelativeTransform );
+
+    StaticMeshComponent->SetStaticMesh( StaticMesh );
+    StaticMeshComponent->SetVisibility( true );
+    StaticMeshComponent->SetMobility( Mobility );
+    StaticMeshComponent->RegisterComponent();
+
+    // Add to the map of components.
+    StaticMeshComponents.Add( StaticMesh, StaticMeshComponent );
+
+    return StaticMeshComponent;
+}
+
+void
+UHoudiniAssetComponent::ReuseObjectGeoPartComponents(
+    const TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap,
+    const TMap< FHoudiniGeoPartObject, UStaticMesh * > & PreviousStaticMeshMap )
+{
+    // Meshes used by several parts are rendered by instanced components, which are not handed over.
+    TMap< UStaticMesh *, int32 > StaticMeshPartCounts;
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( StaticMeshMap ); Iter; ++Iter )
+    {
+        if ( Iter.Value() )
+            StaticMeshPartCounts.FindOrAdd( Iter.Value() )++;
+    }
+
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( StaticMeshMap ); Iter; ++Iter )
+    {
+        const FHoudiniGeoPartObject & HoudiniGeoPartObject = Iter.Key();
+        UStaticMesh * StaticMesh = Iter.Value();
+
+        UStaticMesh * const * PreviousStaticMesh = PreviousStaticMeshMap.Find( HoudiniGeoPartObject );
+        if ( !StaticMesh || !PreviousStaticMesh || !*PreviousStaticMesh || *PreviousStaticMesh == StaticMesh )
+            continue;
+
+        if ( !HoudiniGeoPartObject.IsVisible() || StaticMeshPartCounts[ StaticMesh ] > 1 || LocateStaticMeshComponent( StaticMesh ) )
+            continue;
+
+        UStaticMeshComponent * StaticMeshComponent = LocateStaticMeshComponent( *PreviousStaticMesh );
+        if ( !StaticMeshComponent || StaticMeshComponent->IsA< UInstancedStaticMeshComponent >() )
+            continue;
+
+        // The component stays registered. Material overrides were made for the previous mesh, whose material
+        // replacements have already been applied to the new one.
+        StaticMeshComponents.Remove( *PreviousStaticMesh );
+        StaticMeshComponent->OverrideMaterials.Empty();
+        StaticMeshComponent->SetStaticMesh( StaticMesh );
+        StaticMeshComponents.Add( StaticMesh, StaticMeshComponent );
+    }
+}
+
+void
+UHoudiniAssetComponent::UpdateObjectGeoPartComponent(
+    const FHoudiniGeoPartObject & HoudiniGeoPartObject, UStaticMesh * StaticMesh,
+    UStaticMeshComponent * StaticMeshComponent )
+{
+    // If this is a collision geo, we need to make it invisible.
+    if (HoudiniGeoPartObject.IsCollidable())
+    {
+        StaticMeshComponent->SetVisibility( false );
+        StaticMeshComponent->SetHiddenInGame( true );
+        StaticMeshComponent->SetCollisionProfileName( FName( TEXT( "InvisibleWall" ) ) );
+    }
+    else
+    {
+        // Visibility may have changed so we still need to update it
+        StaticMeshComponent->SetVisibility( HoudiniGeoPartObject.IsVisible() );
+        StaticMeshComponent->SetHiddenInGame( !HoudiniGeoPartObject.IsVisible() );
+    }
+
+    // And we will need to update the navmesh later
+    if( HoudiniGeoPartObject.IsCollidable() || HoudiniGeoPartObject.IsRenderCollidable() )
+        bNeedToUpdateNavigationSystem = true;
+
+    // Transform the component by transformation provided by HAPI.
+    StaticMeshComponent->SetRelativeTransform( HoudiniGeoPartObject.TransformMatrix );
+
+    // If the static mesh had sockets, we can assign the desired actor to them now
+    int32 NumberOfSockets = StaticMesh == nullptr ? 0 : StaticMesh->Sockets.Num();
+    for( int32 nSocket = 0; nSocket < NumberOfSockets; nSocket++ )
+    {
+        UStaticMeshSocket* MeshSocket = StaticMesh->Sockets[ nSocket ];
+        if ( MeshSocket && ( MeshSocket->Tag.IsEmpty() ) )
+            continue;
+
+        FHoudiniEngineUtils::AddActorsToMeshSocket( StaticMesh->Sockets[nSocket], StaticMeshComponent );
+    }
+}
+
+void
+UHoudiniAssetComponent::CreateSharedStaticMeshComponent(
+    UStaticMesh * StaticMesh, const TArray< FTransform > & InstanceTransforms )
+{
+    if ( InstanceTransforms.Num() <= 0 )
+    {
+        // None of the parts sharing this mesh are visible.
+        RemoveStaticMeshComponent( StaticMesh );
+        return;
+    }
+
+    UInstancedStaticMeshComponent * InstancedStaticMeshComponent =
+        Cast< UInstancedStaticMeshComponent >( LocateStaticMeshComponent( StaticMesh ) );
+
+    if ( !InstancedStaticMeshComponent )
+    {
+        // Replace the regular component this mesh had before it was shared.
+        RemoveStaticMeshComponent( StaticMesh );
+
+        InstancedStaticMeshComponent = NewObject< UInstancedStaticMeshComponent >(
+            GetOwner(), UInstancedStaticMeshComponent::StaticClass(),
+            NAME_None, RF_Transactional );
+
+        // Attach created instanced component to our Houdini component.
+        InstancedStaticMeshComponent->AttachToComponent( this, FAttachmentTransformRules::KeepRelativeTransform );
+
+        InstancedStaticMeshComponent->SetStaticMesh( StaticMesh );
+        InstancedStaticMeshComponent->SetMobility( Mobility );
+        InstancedStaticMeshComponent->RegisterComponent();
+
+        // Add to the map of components.
+        StaticMeshComponents.Add( StaticMesh, InstancedStaticMeshComponent );
+    }
+
+    InstancedStaticMeshComponent->SetVisibility( true );
+    InstancedStaticMeshComponent->SetHiddenInGame( false );
+
+    // Instances carry the transforms of the parts, they are all replaced in a single render and physics update.
+    InstancedStaticMeshComponent->SetRelativeTransform( FTransform::Identity );
+    FHoudiniEngineUtils::ReplaceInstancedStaticMeshComponentInstances( InstancedStaticMeshComponent, InstanceTransforms );
+}
+
 void
 UHoudiniAssetComponent::ReleaseObjectGeoPartResources( bool bDeletePackages )
 {
     ReleaseObjectGeoPartResources( StaticMeshes, bDeletePackages );
+#if WITH_EDITOR
+    ReleaseObjectGeoPartResources( StaticMeshBackBuffers, bDeletePackages );
+#endif
 }
 
 void
 UHoudiniAssetComponent::ReleaseObjectGeoPartResources(
     TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap,
-    bool bDeletePackages )
+    bool bDeletePackages, bool bDeferDeletion )
 {
     // Record generated static meshes which we need to delete.
     TArray< UStaticMesh * > StaticMeshesToDelete;
@@ -845,13 +1009,17 @@ UHoudiniAssetComponent::ReleaseObjectGeoPartResources(
     if ( bDeletePackages && MeshNum > 0 )
     {
         for ( int32 MeshIdx = 0; MeshIdx < MeshNum; ++MeshIdx )
-        {
-            UStaticMesh * StaticMesh = StaticMeshesToDelete[ MeshIdx ];
-
-            // Free any RHI resources.
-            StaticMesh->PreEditChange( nullptr );
+            PendingDeleteStaticMeshes.Add( StaticMeshesToDelete[ MeshIdx ] );
 
-            ObjectTools::DeleteSingleObject( StaticMesh, false );
+        if ( bDeferDeletion )
+        {
+            // Their components have been removed, the meshes can go once the rendering thread has caught up.
+            PendingDeleteStaticMeshesFence.BeginFence();
+            StartHoudiniTicking();
+        }
+        else
+        {
+            DeletePendingStaticMeshes( true );
         }
     }
 
@@ -867,6 +1035,11 @@ UHoudiniAssetComponent::CleanUpAttachedStaticMeshComponents()
     // Collect all the static mesh component for this asset
     TMap<const UStaticMeshComponent *, FHoudiniGeoPartObject> AllSMC = CollectAllStaticMeshComponents();
 
+    // Components replaced by a cook are still tracked until they are released, they are not leftovers.
+    TSet< const UStaticMeshComponent * > TrackedStaticMeshComponents;
+    for ( TMap< UStaticMesh *, UStaticMeshComponent * >::TConstIterator Iter( StaticMeshComponents ); Iter; ++Iter )
+        TrackedStaticMeshComponents.Add( Iter.Value() );
+
     // We'll check all the children static mesh components for junk
     const auto & LocalAttachChildren = GetAttachChildren();
     for (TArray< USceneComponent * >::TConstIterator Iter( LocalAttachChildren ); Iter; ++Iter)
@@ -878,7 +1051,7 @@ UHoudiniAssetComponent::CleanUpAttachedStaticMeshComponents()
         bool bNeedToCleanMeshComponent = false;
         UStaticMesh * StaticMesh = StaticMeshComponent->GetStaticMesh();
 
-        if (AllSMC.Find(StaticMeshComponent) == nullptr)
+        if (AllSMC.Find(StaticMeshComponent) == nullptr && !TrackedStaticMeshComponents.Contains( StaticMeshComponent ) )
             bNeedToCleanMeshComponent = true;
         
         // Do not clean up component attached to a socket
@@ -1177,11 +1350,22 @@ UHoudiniAssetComponent::PostCook( bool bCookError )
         return;
     }
 
+    // Shared and merged meshes of the current output are not owned by a single part.
+    TSet< UStaticMesh * > SharedOrMergedStaticMeshes;
+    for ( TMap< UStaticMesh *, FSHAHash >::TConstIterator Iter( SharedStaticMeshHashes ); Iter; ++Iter )
+        SharedOrMergedStaticMeshes.Add( Iter.Key() );
+    for ( TMap< UStaticMesh *, FSHAHash >::TConstIterator Iter( MergedStaticMeshHashes ); Iter; ++Iter )
+        SharedOrMergedStaticMeshes.Add( Iter.Key() );
+
     FTransform ComponentTransform;
     TMap< FHoudiniGeoPartObject, UStaticMesh * > NewStaticMeshes;
     if ( FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
         this, StaticMeshes, NewStaticMeshes, ComponentTransform) )
     {
+        // Components still pending from the previous cook are created first, the new output replaces them. This
+        // must happen while their parts are still mapped to their meshes, before unchanged meshes are removed below.
+        CreatePendingObjectGeoPartComponents( 0.0 );
+
         // Remove all duplicates. After this operation, old map will have meshes which we need
         // to deallocate.
         for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator
@@ -1199,17 +1383,112 @@ UHoudiniAssetComponent::PostCook( bool bCookError )
             }
         }
 
-        // Make sure rendering is done
-        FlushRenderingCommands();
-        
-        // Free meshes and components that are no longer used.
-        ReleaseObjectGeoPartResources(StaticMeshes, true);
+        // Meshes shared by identical parts may now be used by other parts, they must not be released either.
+        TSet< UStaticMesh * > NewStaticMeshSet;
+        for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( NewStaticMeshes ); Iter; ++Iter )
+            NewStaticMeshSet.Add( Iter.Value() );
+
+        for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( StaticMeshes ); Iter; ++Iter )
+        {
+            if ( NewStaticMeshSet.Contains( Iter.Value() ) )
+                Iter.RemoveCurrent();
+        }
+
+        // The new output is staged while the previous one is still displayed: components are created or updated
+        // for the new meshes first, then the previous components are removed within the same frame.
+        TMap< FHoudiniGeoPartObject, UStaticMesh * > PreviousStaticMeshes = StaticMeshes;
+        StaticMeshes.Empty();
+
+        // Parts which were already displayed keep their component, only its mesh is swapped.
+        ReuseObjectGeoPartComponents( NewStaticMeshes, PreviousStaticMeshes );
+
+        // With a creation budget, new components of plain visible parts are created over the next frames. Until
+        // then, these parts keep the components of the previous cook.
+        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+        double ComponentCreationBudget = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->ComponentCreationBudgetMs / 1000.0 : 0.0;
+
+        TMap< FHoudiniGeoPartObject, UStaticMesh * > CreatedStaticMeshes = NewStaticMeshes;
+        if ( ComponentCreationBudget > 0.0 )
+        {
+            TMap< UStaticMesh *, int32 > StaticMeshPartCounts;
+            for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( NewStaticMeshes ); Iter; ++Iter )
+            {
+                if ( Iter.Value() )
+                    StaticMeshPartCounts.FindOrAdd( Iter.Value() )++;
+            }
+
+            for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( NewStaticMeshes ); Iter; ++Iter )
+            {
+                const FHoudiniGeoPartObject & HoudiniGeoPartObject = Iter.Key();
+                UStaticMesh * StaticMesh = Iter.Value();
+
+                if ( !StaticMesh || StaticMeshPartCounts[ StaticMesh ] > 1 || LocateStaticMeshComponent( StaticMesh ) )
+                    continue;
+
+                if ( !HoudiniGeoPartObject.IsVisible() || HoudiniGeoPartObject.IsCollidable() || HoudiniGeoPartObject.IsCurve() ||
+                    HoudiniGeoPartObject.IsInstancer() || HoudiniGeoPartObject.IsPackedPrimitiveInstancer() )
+                    continue;
+
+                PendingComponentGeoPartObjects.Add( HoudiniGeoPartObject );
+                CreatedStaticMeshes.Remove( HoudiniGeoPartObject );
+
+                UStaticMesh * ReplacedStaticMesh = nullptr;
+                if ( PreviousStaticMeshes.RemoveAndCopyValue( HoudiniGeoPartObject, ReplacedStaticMesh ) )
+                    PendingReplacedStaticMeshes.Add( HoudiniGeoPartObject, ReplacedStaticMesh );
+            }
+        }
 
         // Set meshes and create new components for those meshes that do not have them.
         if ( NewStaticMeshes.Num() > 0 )
-            CreateObjectGeoPartResources( NewStaticMeshes );
+            CreateObjectGeoPartResources( CreatedStaticMeshes );
         else
             CreateStaticMeshHoudiniLogoResource( NewStaticMeshes );
+
+        // Parts whose components are pending already have their meshes.
+        for ( int32 PartIdx = 0; PartIdx < PendingComponentGeoPartObjects.Num(); ++PartIdx )
+        {
+            const FHoudiniGeoPartObject & HoudiniGeoPartObject = PendingComponentGeoPartObjects[ PartIdx ];
+            StaticMeshes.Add( HoudiniGeoPartObject, NewStaticMeshes[ HoudiniGeoPartObject ] );
+        }
+
+        if ( PendingComponentGeoPartObjects.Num() > 0 )
+        {
+            // The first slice is created right away, the remaining ones when ticking.
+            PendingComponentCount = PendingComponentGeoPartObjects.Num();
+            if ( !CreatePendingObjectGeoPartComponents( ComponentCreationBudget ) )
+                StartHoudiniTicking();
+        }
+
+        // Back buffers rebuilt by this cook are now displayed. The others were not needed, they are released below.
+        for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( StaticMeshBackBuffers ); Iter; ++Iter )
+        {
+            if ( NewStaticMeshSet.Contains( Iter.Value() ) )
+                Iter.RemoveCurrent();
+        }
+
+        // Meshes replaced for parts which still exist become the back buffers of these parts. Shared and merged
+        // meshes are not owned by a single part, they are released.
+        TMap< FHoudiniGeoPartObject, UStaticMesh * > NewStaticMeshBackBuffers;
+        UStaticMesh * HoudiniLogoMesh = FHoudiniEngine::Get().GetHoudiniLogoStaticMesh();
+        for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( PreviousStaticMeshes ); Iter; ++Iter )
+        {
+            UStaticMesh * StaticMesh = Iter.Value();
+            if ( !StaticMesh || StaticMesh == HoudiniLogoMesh || !NewStaticMeshes.Contains( Iter.Key() )
+                || SharedOrMergedStaticMeshes.Contains( StaticMesh ) )
+            {
+                continue;
+            }
+
+            RemoveStaticMeshComponent( StaticMesh );
+            NewStaticMeshBackBuffers.Add( Iter.Key(), StaticMesh );
+            Iter.RemoveCurrent();
+        }
+
+        // Free components that are no longer used. Their meshes are deleted once the rendering thread has
+        // released them, so that rendering does not need to be flushed here.
+        ReleaseObjectGeoPartResources( PreviousStaticMeshes, true, true );
+        ReleaseObjectGeoPartResources( StaticMeshBackBuffers, true, true );
+        StaticMeshBackBuffers = NewStaticMeshBackBuffers;
     }
 
     // We can reset the manual recook flag now that the static meshes have been created
@@ -1618,25 +1897,276 @@ UHoudiniAssetComponent::TickHoudiniComponent()
         }
     }
 
-    if (bNeedToUpdateNavigationSystem)
+    // Collision and navigation updates can be deferred until we have nothing left to cook.
+    bool bDeferCollisionNavigationRebuild = false;
+    if ( HoudiniRuntimeSettings )
+        bDeferCollisionNavigationRebuild = HoudiniRuntimeSettings->bDeferCollisionNavigationRebuild;
+
+    if ( !bDeferCollisionNavigationRebuild || bStopTicking )
+        FlushPendingCollisionChanges();
+
+    // Meshes built with preview settings get their full build once nothing has been cooked for a while.
+    if ( bStopTicking && PendingFullQualityStaticMeshes.Num() > 0 )
+    {
+        float PreviewMeshFullBuildDelay = 0.0f;
+        if ( HoudiniRuntimeSettings )
+            PreviewMeshFullBuildDelay = HoudiniRuntimeSettings->PreviewMeshFullBuildDelay;
+
+        if ( FPlatformTime::Seconds() - PreviewMeshBuildTime >= PreviewMeshFullBuildDelay )
+            BuildPendingFullQualityStaticMeshes();
+        else
+            bStopTicking = false;
+    }
+
+    // Components which did not fit in the creation budget of previous frames.
+    if ( PendingComponentGeoPartObjects.Num() > 0 )
     {
-#ifdef WITH_EDITOR
-        // We need to update the navigation system manually with the Actor or the NavMesh will not update properly
-        UWorld* World = GEditor->GetEditorWorldContext().World();
-        if (World && World->GetNavigationSystem())
+        double ComponentCreationBudget = 0.0;
+        if ( HoudiniRuntimeSettings )
+            ComponentCreationBudget = HoudiniRuntimeSettings->ComponentCreationBudgetMs / 1000.0;
+
+        bool bComponentsCreated = CreatePendingObjectGeoPartComponents( ComponentCreationBudget );
+
+        if ( bDisplaySlateCookingNotifications )
         {
-            AHoudiniAssetActor* HoudiniActor = GetHoudiniAssetActorOwner();
-            if(HoudiniActor)
-                World->GetNavigationSystem()->UpdateActorAndComponentsInNavOctree(*HoudiniActor);
+            FText ProgressText = FText::FromString( FString::Printf(
+                TEXT( "Creating components: %d / %d" ),
+                PendingComponentCount - PendingComponentGeoPartObjects.Num(), PendingComponentCount ) );
+
+            if ( !NotificationPtr.IsValid() && !bComponentsCreated && !IsPIEActive() )
+            {
+                FNotificationInfo Info( ProgressText );
+
+                Info.bFireAndForget = false;
+                Info.FadeOutDuration = NotificationFadeOutDuration;
+                Info.ExpireDuration = NotificationExpireDuration;
+
+                TSharedPtr< FSlateDynamicImageBrush > HoudiniBrush = FHoudiniEngine::Get().GetHoudiniLogoBrush();
+                if ( HoudiniBrush.IsValid() )
+                    Info.Image = HoudiniBrush.Get();
+
+                NotificationPtr = FSlateNotificationManager::Get().AddNotification( Info );
+            }
+
+            TSharedPtr< SNotificationItem > NotificationItem = NotificationPtr.Pin();
+            if ( NotificationItem.IsValid() )
+            {
+                NotificationItem->SetText( ProgressText );
+
+                if ( bComponentsCreated && !HapiGUID.IsValid() )
+                {
+                    NotificationItem->ExpireAndFadeout();
+                    NotificationPtr.Reset();
+                }
+            }
         }
-#endif
-        bNeedToUpdateNavigationSystem = false;
+
+        if ( !bComponentsCreated )
+            bStopTicking = false;
+    }
+
+    // Meshes replaced by a cook are deleted once the rendering thread has released them.
+    if ( PendingDeleteStaticMeshes.Num() > 0 )
+    {
+        DeletePendingStaticMeshes( false );
+        if ( PendingDeleteStaticMeshes.Num() > 0 )
+            bStopTicking = false;
     }
 
     if ( bStopTicking )
         StopHoudiniTicking();
 }
 
+void
+UHoudiniAssetComponent::RefreshCollisionChanges( const TSet< UStaticMesh * > & CollisionChangedStaticMeshes )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings && HoudiniRuntimeSettings->bDeferCollisionNavigationRebuild )
+    {
+        for ( TSet< UStaticMesh * >::TConstIterator Iter( CollisionChangedStaticMeshes ); Iter; ++Iter )
+            PendingCollisionChangedStaticMeshes.Add( *Iter );
+
+        // Make sure we tick until idle so that the pending updates get performed.
+        StartHoudiniTicking();
+        return;
+    }
+
+    FHoudiniEngineUtils::RefreshCollisionChanges( CollisionChangedStaticMeshes );
+}
+
+void
+UHoudiniAssetComponent::QueueFullQualityStaticMeshBuilds( const TSet< UStaticMesh * > & PreviewStaticMeshes )
+{
+    if ( PreviewStaticMeshes.Num() <= 0 )
+        return;
+
+    for ( TSet< UStaticMesh * >::TConstIterator Iter( PreviewStaticMeshes ); Iter; ++Iter )
+        PendingFullQualityStaticMeshes.Add( *Iter );
+
+    PreviewMeshBuildTime = FPlatformTime::Seconds();
+
+    // Make sure we tick until idle so that the full builds get performed.
+    StartHoudiniTicking();
+}
+
+bool
+UHoudiniAssetComponent::CreatePendingObjectGeoPartComponents( double TimeBudget )
+{
+    if ( PendingComponentGeoPartObjects.Num() <= 0 )
+        return true;
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // At least one component is created per slice, so that creation always progresses.
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > ReplacedStaticMeshes;
+    int32 CreatedCount = 0;
+    while ( CreatedCount < PendingComponentGeoPartObjects.Num() )
+    {
+        if ( TimeBudget > 0.0 && CreatedCount > 0 && FPlatformTime::Seconds() - StartTime >= TimeBudget )
+            break;
+
+        const FHoudiniGeoPartObject & HoudiniGeoPartObject = PendingComponentGeoPartObjects[ CreatedCount++ ];
+
+        UStaticMesh * StaticMesh = LocateStaticMesh( HoudiniGeoPartObject );
+        if ( StaticMesh && !LocateStaticMeshComponent( StaticMesh ) )
+        {
+            UStaticMeshComponent * StaticMeshComponent = CreateObjectGeoPartComponent( StaticMesh );
+            UpdateObjectGeoPartComponent( HoudiniGeoPartObject, StaticMesh, StaticMeshComponent );
+        }
+
+        UStaticMesh * ReplacedStaticMesh = nullptr;
+        if ( PendingReplacedStaticMeshes.RemoveAndCopyValue( HoudiniGeoPartObject, ReplacedStaticMesh ) )
+            ReplacedStaticMeshes.Add( HoudiniGeoPartObject, ReplacedStaticMesh );
+    }
+
+    PendingComponentGeoPartObjects.RemoveAt( 0, CreatedCount );
+
+    // The components replaced by this slice go within the same frame.
+    if ( PendingComponentGeoPartObjects.Num() <= 0 )
+    {
+        ReplacedStaticMeshes.Append( PendingReplacedStaticMeshes );
+        PendingReplacedStaticMeshes.Empty();
+        PendingComponentCount = 0;
+    }
+
+    ReleaseObjectGeoPartResources( ReplacedStaticMeshes, true, true );
+
+    return PendingComponentGeoPartObjects.Num() <= 0;
+}
+
+void
+UHoudiniAssetComponent::DeletePendingStaticMeshes( bool bWaitForRendering )
+{
+    if ( PendingDeleteStaticMeshes.Num() <= 0 )
+        return;
+
+    if ( !PendingDeleteStaticMeshesFence.IsFenceComplete() )
+    {
+        if ( !bWaitForRendering )
+            return;
+
+        PendingDeleteStaticMeshesFence.Wait();
+    }
+
+    for ( int32 MeshIdx = 0; MeshIdx < PendingDeleteStaticMeshes.Num(); ++MeshIdx )
+    {
+        UStaticMesh * StaticMesh = PendingDeleteStaticMeshes[ MeshIdx ].Get();
+        if ( !StaticMesh || StaticMesh->IsPendingKill() )
+            continue;
+
+        // Free any RHI resources.
+        StaticMesh->PreEditChange( nullptr );
+
+        // Preview meshes, transient or saved with this component, were never registered as assets, there is
+        // nothing else to clean up.
+        if ( StaticMesh->GetOutermost() == GetTransientPackage() || StaticMesh->GetOutermost() == GetOutermost() )
+            StaticMesh->MarkPendingKill();
+        else
+            ObjectTools::DeleteSingleObject( StaticMesh, false );
+    }
+
+    PendingDeleteStaticMeshes.Empty();
+}
+
+void
+UHoudiniAssetComponent::BuildPendingFullQualityStaticMeshes()
+{
+    if ( PendingFullQualityStaticMeshes.Num() <= 0 )
+        return;
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    check( HoudiniRuntimeSettings );
+
+    TSet< UStaticMesh * > CollisionChangedStaticMeshes;
+    FRawMesh RawMesh;
+
+    for ( TSet< TWeakObjectPtr< UStaticMesh > >::TConstIterator Iter( PendingFullQualityStaticMeshes ); Iter; ++Iter )
+    {
+        UStaticMesh * StaticMesh = Iter->Get();
+        if ( !StaticMesh )
+            continue;
+
+        // Restore the full build settings of every source model holding geometry, generated LODs have none.
+        for ( int32 SourceModelIdx = 0; SourceModelIdx < StaticMesh->SourceModels.Num(); ++SourceModelIdx )
+        {
+            FStaticMeshSourceModel & SrcModel = StaticMesh->SourceModels[ SourceModelIdx ];
+            if ( SrcModel.RawMeshBulkData->IsEmpty() )
+                continue;
+
+            SrcModel.RawMeshBulkData->LoadRawMesh( RawMesh );
+            HoudiniRuntimeSettings->SetMeshBuildSettings( SrcModel.BuildSettings, RawMesh );
+            SrcModel.BuildSettings.DistanceFieldResolutionScale = GeneratedDistanceFieldResolutionScale;
+
+            if ( SrcModel.BuildSettings.bGenerateLightmapUVs &&
+                FHoudiniEngineUtils::ContainsInvalidLightmapFaces( RawMesh, StaticMesh->LightMapCoordinateIndex ) )
+            {
+                SrcModel.BuildSettings.bGenerateLightmapUVs = false;
+            }
+        }
+
+        // Free any RHI resources.
+        StaticMesh->PreEditChange( nullptr );
+
+        FHoudiniScopedGlobalSilence ScopedGlobalSilence;
+        StaticMesh->Build( true );
+        CollisionChangedStaticMeshes.Add( StaticMesh );
+    }
+
+    PendingFullQualityStaticMeshes.Empty();
+    RefreshCollisionChanges( CollisionChangedStaticMeshes );
+}
+
+void
+UHoudiniAssetComponent::FlushPendingCollisionChanges()
+{
+    if ( PendingCollisionChangedStaticMeshes.Num() > 0 )
+    {
+        TSet< UStaticMesh * > CollisionChangedStaticMeshes;
+        for ( TSet< TWeakObjectPtr< UStaticMesh > >::TConstIterator Iter( PendingCollisionChangedStaticMeshes ); Iter; ++Iter )
+        {
+            if ( Iter->IsValid() )
+                CollisionChangedStaticMeshes.Add( Iter->Get() );
+        }
+
+        PendingCollisionChangedStaticMeshes.Empty();
+        FHoudiniEngineUtils::RefreshCollisionChanges( CollisionChangedStaticMeshes );
+    }
+
+    if ( bNeedToUpdateNavigationSystem )
+    {
+        // We need to update the navigation system manually with the Actor or the NavMesh will not update properly
+        UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+        if ( World && World->GetNavigationSystem() )
+        {
+            AHoudiniAssetActor* HoudiniActor = GetHoudiniAssetActorOwner();
+            if ( HoudiniActor )
+                World->GetNavigationSystem()->UpdateActorAndComponentsInNavOctree( *HoudiniActor );
+        }
+
+        bNeedToUpdateNavigationSystem = false;
+    }
+}
+
 void
 UHoudiniAssetComponent::UpdateEditorProperties( bool bConditionalUpdate )
 {
@@ -2051,6 +2581,15 @@ UHoudiniAssetComponent::PostEditChangeProperty( FPropertyChangedEvent & Property
         CheckedUploadTransform();
     }
 
+    if ( Property->GetName() == TEXT( "bGeneratedUsePreviewMeshBuild" ) )
+    {
+        // Turning previews off should not leave meshes with their preview build.
+        if ( !bGeneratedUsePreviewMeshBuild )
+            BuildPendingFullQualityStaticMeshes();
+
+        return;
+    }
+
     if ( Property->HasMetaData( TEXT( "Category" ) ) )
     {
         const FString & Category = Property->GetMetaData( TEXT( "Category" ) );
@@ -2060,6 +2599,7 @@ UHoudiniAssetComponent::PostEditChangeProperty( FPropertyChangedEvent & Property
         if ( CategoryHoudiniGeneratedStaticMeshSettings == Category )
         {
             // We are changing one of the mesh generation properties, we need to update all static meshes.
+            TSet< UStaticMesh * > CollisionChangedStaticMeshes;
             for ( TMap< UStaticMesh *, UStaticMeshComponent * >::TIterator Iter( StaticMeshComponents ); Iter; ++Iter )
             {
                 UStaticMesh * StaticMesh = Iter.Key();
@@ -2067,9 +2607,11 @@ UHoudiniAssetComponent::PostEditChangeProperty( FPropertyChangedEvent & Property
                 SetStaticMeshGenerationParameters( StaticMesh );
                 FHoudiniScopedGlobalSilence ScopedGlobalSilence;
                 StaticMesh->Build( true );
-                RefreshCollisionChange( StaticMesh );
+                CollisionChangedStaticMeshes.Add( StaticMesh );
             }
 
+            RefreshCollisionChanges( CollisionChangedStaticMeshes );
+
             return;
         }
         else if ( CategoryLighting == Category )
@@ -2587,6 +3129,19 @@ UHoudiniAssetComponent::BeginDestroy()
 void
 UHoudiniAssetComponent::OnComponentDestroyed( bool bDestroyingHierarchy )
 {
+#if WITH_EDITOR
+    // Parts whose components were still pending keep the components they were replacing until now.
+    ReleaseObjectGeoPartResources( PendingReplacedStaticMeshes );
+    PendingComponentGeoPartObjects.Empty();
+    PendingComponentCount = 0;
+
+    // Back buffers are not displayed, nothing else owns them.
+    ReleaseObjectGeoPartResources( StaticMeshBackBuffers, true, true );
+
+    // Meshes replaced by the last cook are still waiting for their deletion.
+    DeletePendingStaticMeshes( true );
+#endif
+
     // Release static mesh related resources.
     ReleaseObjectGeoPartResources( StaticMeshes );
     StaticMeshes.Empty();
@@ -2601,6 +3156,19 @@ UHoudiniAssetComponent::OnComponentDestroyed( bool bDestroyingHierarchy )
     // Destroy all inputs.
     ClearInputs();
 
+#if WITH_EDITOR
+    // Foliage is only removed when the component is explicitly destroyed, garbage collection
+    // of an unloading level must leave the foliage of the level alone.
+    if ( !IsUnreachable() && !GExitPurge )
+    {
+        for ( UHoudiniAssetInstanceInput * InstanceInput : InstanceInputs )
+        {
+            if ( InstanceInput )
+                InstanceInput->ClearFoliageInstances();
+        }
+    }
+#endif
+
     // Destroy all instance inputs.
     ClearInstanceInputs();
 
@@ -2760,6 +3328,37 @@ UHoudiniAssetComponent::PostLoad()
 #endif
 }
 
+void
+UHoudiniAssetComponent::PreSave( const class ITargetPlatform * TargetPlatform )
+{
+    Super::PreSave( TargetPlatform );
+
+#if WITH_EDITOR
+
+    // Saved meshes should not keep their preview build.
+    BuildPendingFullQualityStaticMeshes();
+
+    // Saved output must be complete, and replaced meshes must not be saved. Back buffers are replaced meshes too.
+    CreatePendingObjectGeoPartComponents( 0.0 );
+    ReleaseObjectGeoPartResources( StaticMeshBackBuffers, true, true );
+    DeletePendingStaticMeshes( true );
+
+    // Transient preview meshes cannot be referenced from a saved level. Packages created now would not be part
+    // of this save, so the meshes are moved into the package of this component, which is being saved.
+    UPackage * ComponentPackage = GetOutermost();
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( StaticMeshes ); Iter; ++Iter )
+    {
+        UStaticMesh * StaticMesh = Iter.Value();
+        if ( !StaticMesh || StaticMesh->GetOutermost() != GetTransientPackage() )
+            continue;
+
+        const FName MeshName = MakeUniqueObjectName( ComponentPackage, UStaticMesh::StaticClass(), StaticMesh->GetFName() );
+        StaticMesh->Rename( *MeshName.ToString(), ComponentPackage, REN_DontCreateRedirectors | REN_NonTransactional );
+    }
+
+#endif
+}
+
 void
 UHoudiniAssetComponent::Serialize( FArchive & Ar )
 {
@@ -3188,6 +3787,7 @@ UHoudiniAssetComponent::PostInitProperties()
         GeneratedFoliageDefaultSettings = HoudiniRuntimeSettings->FoliageDefaultSettings;
         GeneratedAssetUserData = HoudiniRuntimeSettings->AssetUserData;
         GeneratedDistanceFieldResolutionScale = HoudiniRuntimeSettings->GeneratedDistanceFieldResolutionScale;
+        bGeneratedUsePreviewMeshBuild = HoudiniRuntimeSettings->bUsePreviewMeshBuild;
     }
 }
 
@@ -3196,46 +3796,38 @@ UHoudiniAssetComponent::LocateStaticMeshes(
     const FString & ObjectName,
     TMap< FString, TArray< FHoudiniGeoPartObject > > & InOutObjectsToInstance, bool bSubstring ) const
 {
-    // See if map has entry for this object name.
-    if ( !InOutObjectsToInstance.Contains( ObjectName ) )
-        InOutObjectsToInstance.Add( ObjectName, TArray< FHoudiniGeoPartObject >() );
+    QUICK_SCOPE_CYCLE_COUNTER( STAT_HoudiniAssetComponent_LocateStaticMeshesByName );
+
+    // Get array entry for this object name, adding it if necessary.
+    TArray< FHoudiniGeoPartObject > & Objects = InOutObjectsToInstance.FindOrAdd( ObjectName );
 
+    // Go through all geo part objects and see if we have matches.
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( StaticMeshes ); Iter; ++Iter )
     {
-        // Get array entry for this object name.
-        TArray< FHoudiniGeoPartObject > & Objects = InOutObjectsToInstance[ ObjectName ];
+        const FHoudiniGeoPartObject & HoudiniGeoPartObject = Iter.Key();
+        UStaticMesh * StaticMesh = Iter.Value();
 
-        // Go through all geo part objects and see if we have matches.
-        for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( StaticMeshes ); Iter; ++Iter )
+        if ( StaticMesh && ObjectName.Len() > 0 )
         {
-            const FHoudiniGeoPartObject & HoudiniGeoPartObject = Iter.Key();
-            UStaticMesh * StaticMesh = Iter.Value();
-
-            if ( StaticMesh && ObjectName.Len() > 0 )
+            if ( bSubstring && ObjectName.Len() >= HoudiniGeoPartObject.ObjectName.Len() )
             {
-                if ( bSubstring && ObjectName.Len() >= HoudiniGeoPartObject.ObjectName.Len() )
-                {
-                    int32 Index = ObjectName.Find(
-                        *HoudiniGeoPartObject.ObjectName,
-                        ESearchCase::IgnoreCase,
-                        ESearchDir::FromEnd, INDEX_NONE );
+                int32 Index = ObjectName.Find(
+                    *HoudiniGeoPartObject.ObjectName,
+                    ESearchCase::IgnoreCase,
+                    ESearchDir::FromEnd, INDEX_NONE );
 
-                    if ( ( Index != -1 ) && ( Index + HoudiniGeoPartObject.ObjectName.Len() == ObjectName.Len() ) )
-                        Objects.Add( HoudiniGeoPartObject );
-                }
-                else if ( HoudiniGeoPartObject.ObjectName.Equals( ObjectName ) )
-                {
+                if ( ( Index != -1 ) && ( Index + HoudiniGeoPartObject.ObjectName.Len() == ObjectName.Len() ) )
                     Objects.Add( HoudiniGeoPartObject );
-                }
+            }
+            else if ( HoudiniGeoPartObject.ObjectName.Equals( ObjectName ) )
+            {
+                Objects.Add( HoudiniGeoPartObject );
             }
         }
     }
 
-    // Sort arrays.
-    for ( TMap< FString, TArray< FHoudiniGeoPartObject > >::TIterator Iter( InOutObjectsToInstance ); Iter; ++Iter )
-    {
-        TArray< FHoudiniGeoPartObject > & Objects = Iter.Value();
-        Objects.Sort( FHoudiniGeoPartObjectSortPredicate() );
-    }
+    // Only the entry for this object name has changed, previously located entries are already sorted.
+    Objects.Sort( FHoudiniGeoPartObjectSortPredicate() );
 
     return InOutObjectsToInstance.Num() > 0;
 }
@@ -3245,6 +3837,8 @@ UHoudiniAssetComponent::LocateStaticMeshes(
     int32 ObjectToInstanceId,
     TArray< FHoudiniGeoPartObject > & InOutObjectsToInstance ) const
 {
+    QUICK_SCOPE_CYCLE_COUNTER( STAT_HoudiniAssetComponent_LocateStaticMeshesById );
+
     for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( StaticMeshes ); Iter; ++Iter )
     {
         const FHoudiniGeoPartObject& HoudiniGeoPartObject = Iter.Key();
@@ -4106,6 +4700,15 @@ UHoudiniAssetComponent::CreateInstanceInputs( const TArray< FHoudiniGeoPartObjec
         }
     }
 
+#if WITH_EDITOR
+    // Instancers the asset no longer produces take their foliage with them.
+    for ( UHoudiniAssetInstanceInput * InstanceInput : InstanceInputs )
+    {
+        if ( InstanceInput )
+            InstanceInput->ClearFoliageInstances();
+    }
+#endif
+
     // Clear all the existing instance inputs and replace with the new
     ClearInstanceInputs();
     InstanceInputs = NewInstanceInputs;
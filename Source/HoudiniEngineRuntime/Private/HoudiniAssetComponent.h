@@ -147,6 +147,13 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetComponent : public UPrimitiveCompone
             meta = (DisplayName = "Distance Field Resolution Scale", UIMin = "0.0", UIMax = "100.0"))
             float GeneratedDistanceFieldResolutionScale;
 
+        /** Build meshes without lightmap UVs, distance fields and Mikk T Space tangents while cooking. They are **/
+        /** rebuilt with the full build settings once the asset is idle, saved or baked. **/
+        UPROPERTY( EditAnywhere,
+            Category = HoudiniGeneratedStaticMeshSettings,
+            meta = ( DisplayName = "Preview Build While Cooking" ) )
+        uint32 bGeneratedUsePreviewMeshBuild : 1;
+
         /** Custom walkable slope setting for generated mesh's body. */
         UPROPERTY( EditAnywhere, AdvancedDisplay,
             Category = HoudiniGeneratedStaticMeshSettings,
@@ -227,6 +234,22 @@ public:
         /** Assign generation parameters to static mesh. **/
         void SetStaticMeshGenerationParameters( UStaticMesh * StaticMesh ) const;
 
+        /** Refresh collision and navigation data of generated meshes, now or once this component is idle. **/
+        void RefreshCollisionChanges( const TSet< UStaticMesh * > & CollisionChangedStaticMeshes );
+
+        /** Schedule the full build of meshes which have been built with preview settings. **/
+        void QueueFullQualityStaticMeshBuilds( const TSet< UStaticMesh * > & PreviewStaticMeshes );
+
+        /** Rebuild all meshes built with preview settings using the full build settings. **/
+        void BuildPendingFullQualityStaticMeshes();
+
+        /** Delete meshes replaced by previous cooks, optionally waiting for the rendering thread to release them. **/
+        void DeletePendingStaticMeshes( bool bWaitForRendering );
+
+        /** Create the components left over by time-sliced component creation, within the given budget in seconds. **/
+        /** A budget of zero creates all of them. Returns true once all components have been created.             **/
+        bool CreatePendingObjectGeoPartComponents( double TimeBudget );
+
         /** Used by Blueprint baking; create temporary actor and necessary components to bake a blueprint. **/
         AActor * CloneComponentsAndCreateActor();
 
@@ -359,6 +382,7 @@ public:
 #endif
 
         virtual void PostLoad() override;
+        virtual void PreSave( const class ITargetPlatform * TargetPlatform ) override;
         virtual void Serialize( FArchive & Ar ) override;
         virtual void PostInitProperties() override;
         virtual void BeginDestroy() override;
@@ -396,6 +420,9 @@ public:
         /** Called after each cook. **/
         void PostCook( bool bCookError = false );
 
+        /** Perform collision, navigation collision and navigation system updates deferred until idle. **/
+        void FlushPendingCollisionChanges();
+
         /** Check ourselves over and fix up any errors */
         void SanitizePostLoad();
 
@@ -533,9 +560,10 @@ public:
         void ClearDownstreamAssets();
 
         /** Delete Static mesh resources. This will free static meshes and corresponding components. **/
+        /** If deletion is deferred, meshes are deleted once the rendering thread no longer uses them. **/
         void ReleaseObjectGeoPartResources(
             TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap, 
-            bool bDeletePackages = false );
+            bool bDeletePackages = false, bool bDeferDeletion = false );
 
         /** Return true if given object is referenced locally only, by objects generated and owned by this component. **/
         bool IsObjectReferencedLocally( UStaticMesh * StaticMesh, FReferencerInformationList & Referencers ) const;
@@ -551,6 +579,22 @@ public:
         /** Create Static mesh resources. This will create necessary components for each mesh and update maps. **/
         void CreateObjectGeoPartResources( TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap );
 
+        /** Create or update the instanced component rendering a mesh shared by identical parts. **/
+        void CreateSharedStaticMeshComponent( UStaticMesh * StaticMesh, const TArray< FTransform > & InstanceTransforms );
+
+        /** Create and register the component of a static mesh. **/
+        UStaticMeshComponent * CreateObjectGeoPartComponent( UStaticMesh * StaticMesh );
+
+        /** Hand the components of the previous meshes of geo parts over to their new meshes, keeping them registered. **/
+        void ReuseObjectGeoPartComponents(
+            const TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap,
+            const TMap< FHoudiniGeoPartObject, UStaticMesh * > & PreviousStaticMeshMap );
+
+        /** Update visibility, collision, transform and socket actors of the component of a geo part. **/
+        void UpdateObjectGeoPartComponent(
+            const FHoudiniGeoPartObject & HoudiniGeoPartObject, UStaticMesh * StaticMesh,
+            UStaticMeshComponent * StaticMeshComponent );
+
         /** Delete Static mesh resources. This will free static meshes and corresponding components. **/
         void ReleaseObjectGeoPartResources( bool bDeletePackages = false );
 
@@ -655,6 +699,40 @@ public:
         /** Component from which this component has been copied. **/
         UHoudiniAssetComponent * CopiedHoudiniComponent;
 
+        /** Generated meshes whose collision and navigation refresh is deferred until this component is idle. **/
+        TSet< TWeakObjectPtr< UStaticMesh > > PendingCollisionChangedStaticMeshes;
+
+        /** Generated meshes built with preview settings, waiting for their full build. **/
+        TSet< TWeakObjectPtr< UStaticMesh > > PendingFullQualityStaticMeshes;
+
+        /** Time at which meshes were last built with preview settings. **/
+        double PreviewMeshBuildTime;
+
+        /** Generated meshes replaced by a cook, deleted once the fence issued when they were replaced completes. **/
+        TArray< TWeakObjectPtr< UStaticMesh > > PendingDeleteStaticMeshes;
+        FRenderCommandFence PendingDeleteStaticMeshesFence;
+
+        /** Meshes replaced by the last cook, per part. The next cook rebuilding a part builds it into its back buffer. **/
+        TMap< FHoudiniGeoPartObject, UStaticMesh * > StaticMeshBackBuffers;
+
+        /** Parts whose components are created over the next frames, and the meshes of the components they replace. **/
+        TArray< FHoudiniGeoPartObject > PendingComponentGeoPartObjects;
+        TMap< FHoudiniGeoPartObject, UStaticMesh * > PendingReplacedStaticMeshes;
+
+        /** Number of components to create when time-sliced component creation started, used to report progress. **/
+        int32 PendingComponentCount;
+
+        /** Content hashes and first vertex positions of the meshes shared by identical parts. **/
+        TMap< UStaticMesh *, FSHAHash > SharedStaticMeshHashes;
+        TMap< UStaticMesh *, FVector > SharedStaticMeshOrigins;
+
+        /** Content hashes and first vertex positions of the parts using shared meshes, by part. **/
+        TMap< FHoudiniGeoPartObject, FSHAHash > SharedGeoPartHashes;
+        TMap< FHoudiniGeoPartObject, FVector > SharedGeoPartOrigins;
+
+        /** Content hashes of the combined meshes of merged parts. **/
+        TMap< UStaticMesh *, FSHAHash > MergedStaticMeshHashes;
+
 #endif
 
         /** Unique GUID created by component. **/
@@ -44,6 +44,7 @@
 #include "HoudiniPluginSerializationVersion.h"
 #include "HoudiniEngineString.h"
 #include "Components/SplineComponent.h"
+#include "LandscapeComponent.h"
 
 void
 FHoudiniAssetInputOutlinerMesh::Serialize( FArchive & Ar )
@@ -307,16 +308,28 @@ UHoudiniAssetInput::DisconnectAndDestroyInputAsset()
                     InputOutlinerMeshArray[n].AssetId = -1;
                 }
             }
+
+            InputOutlinerMergeAssetIds.Empty();
         }
         // Destroy all the geo input assets
         else if ( ChoiceIndex == EHoudiniAssetInputType::GeometryInput )
         {
+            // Mesh input assets may be shared with other inputs.
             for ( HAPI_NodeId AssetNodeId : GeometryInputAssetIds )
             {
-                FHoudiniEngineUtils::DestroyHoudiniAsset( AssetNodeId );
+                FHoudiniEngineUtils::HapiReleaseInputAsset( AssetNodeId );
             }
             GeometryInputAssetIds.Empty();
         }
+        // Destroy the heightfield volume assets
+        else if ( ChoiceIndex == EHoudiniAssetInputType::LandscapeInput )
+        {
+            for ( HAPI_AssetId VolumeAssetId : LandscapeInputVolumeAssetIds )
+            {
+                FHoudiniEngineUtils::DestroyHoudiniAsset( VolumeAssetId );
+            }
+            LandscapeInputVolumeAssetIds.Empty();
+        }
 
         if (FHoudiniEngineUtils::IsValidAssetId(ConnectedAssetId))
         {
@@ -489,6 +502,27 @@ UHoudiniAssetInput::CreateWidget( IDetailCategoryBuilder & LocalDetailCategoryBu
             ];
         }
 
+	// Checkbox : Export as heightfield
+        {
+            TSharedPtr< SCheckBox > CheckBoxExportAsHeightfield;
+            VerticalBox->AddSlot().Padding( 2, 2, 5, 2 ).AutoHeight()
+            [
+                SAssignNew( CheckBoxExportAsHeightfield, SCheckBox )
+                .Content()
+                [
+                    SNew( STextBlock )
+                    .Text( LOCTEXT( "LandscapeHeightfieldCheckbox", "Export Landscape As Heightfield" ) )
+                    .ToolTipText( LOCTEXT( "LandscapeHeightfieldCheckbox", "Export Landscape As Heightfield" ) )
+                    .Font( FEditorStyle::GetFontStyle( TEXT( "PropertyWindow.NormalFont" ) ) )
+                ]
+                .IsChecked( TAttribute< ECheckBoxState >::Create(
+                    TAttribute< ECheckBoxState >::FGetter::CreateUObject(
+                        this, &UHoudiniAssetInput::IsCheckedExportAsHeightfield ) ) )
+                .OnCheckStateChanged( FOnCheckStateChanged::CreateUObject(
+                    this, &UHoudiniAssetInput::CheckStateChangedExportAsHeightfield ) )
+            ];
+        }
+
 	// Checkbox : Export full geometry
         {
             TSharedPtr< SCheckBox > CheckBoxExportFullGeometry;
@@ -1133,15 +1167,44 @@ UHoudiniAssetInput::UploadParameterValue()
         {
             if ( InputLandscapeProxy )
             {
+                // Changes made by sculpting or painting only re-upload the volume tiles covering the changed components.
+                // Any other change, or volumes which no longer match the landscape, export the whole landscape again.
+                bool bLandscapeUpdated = false;
+                if ( bLandscapeInputSculpted && bLandscapeExportAsHeightfield && !bLandscapeInputSelectionOnly
+                    && !bLoadedParameter && LandscapeInputDirtyComponents.Num() > 0
+                    && LandscapeInputVolumeAssetIds.Num() > 0 && FHoudiniEngineUtils::IsValidAssetId( ConnectedAssetId ) )
+                {
+                    bLandscapeUpdated = FHoudiniEngineUtils::HapiUpdateHeightfieldAsset(
+                        InputLandscapeProxy, LandscapeInputVolumeAssetIds, LandscapeInputDirtyComponents );
+                }
+
+                bLandscapeInputSculpted = false;
+                LandscapeInputDirtyComponents.Empty();
+
+                if ( bLandscapeUpdated )
+                    break;
+
                 // Disconnect and destroy currently connected asset, if there's one.
                 DisconnectAndDestroyInputAsset();
 
                 // Connect input and create connected asset. Will return by reference.
-                if ( !FHoudiniEngineUtils::HapiCreateAndConnectAsset(
-                    HostAssetId, InputIndex, InputLandscapeProxy,
-                    ConnectedAssetId, bLandscapeInputSelectionOnly, bLandscapeExportCurves,
-                    bLandscapeExportMaterials, bLandscapeExportFullGeometry, bLandscapeExportLighting,
-                    bLandscapeExportNormalizedUVs, bLandscapeExportTileUVs ) )
+                bool bLandscapeExported = false;
+                if ( bLandscapeExportAsHeightfield )
+                {
+                    bLandscapeExported = FHoudiniEngineUtils::HapiCreateAndConnectHeightfieldAsset(
+                        HostAssetId, InputIndex, InputLandscapeProxy,
+                        ConnectedAssetId, LandscapeInputVolumeAssetIds, bLandscapeInputSelectionOnly );
+                }
+                else
+                {
+                    bLandscapeExported = FHoudiniEngineUtils::HapiCreateAndConnectAsset(
+                        HostAssetId, InputIndex, InputLandscapeProxy,
+                        ConnectedAssetId, bLandscapeInputSelectionOnly, bLandscapeExportCurves,
+                        bLandscapeExportMaterials, bLandscapeExportFullGeometry, bLandscapeExportLighting,
+                        bLandscapeExportNormalizedUVs, bLandscapeExportTileUVs );
+                }
+
+                if ( !bLandscapeExported )
                 {
                     bChanged = false;
                     ConnectedAssetId = -1;
@@ -1165,12 +1228,14 @@ UHoudiniAssetInput::UploadParameterValue()
             {
                 if ( bStaticMeshChanged || bLoadedParameter )
                 {
-                    // Disconnect and destroy currently connected asset, if there's one.
-                    DisconnectAndDestroyInputAsset();
+                    // Loaded assets are rebuilt, otherwise the merge asset is kept and only changed actors are exported.
+                    if ( bLoadedParameter )
+                        DisconnectAndDestroyInputAsset();
 
                     // Connect input and create connected asset. Will return by reference.
                     if ( !FHoudiniEngineUtils::HapiCreateAndConnectAsset(
-                            HostAssetId, InputIndex, InputOutlinerMeshArray, ConnectedAssetId, UnrealSplineResolution ) )
+                            HostAssetId, InputIndex, InputOutlinerMeshArray, ConnectedAssetId,
+                            InputOutlinerMergeAssetIds, UnrealSplineResolution ) )
                     {
                         bChanged = false;
                         ConnectedAssetId = -1;
@@ -1296,6 +1361,24 @@ UHoudiniAssetInput::BeginDestroy()
 {
     Super::BeginDestroy();
 
+#if WITH_EDITOR
+
+    // Stop listening to editor events.
+    if ( GEngine && WorldOutlinerActorMovedHandle.IsValid() )
+    {
+        GEngine->OnActorMoved().Remove( WorldOutlinerActorMovedHandle );
+        GEngine->OnLevelActorDeleted().Remove( WorldOutlinerActorDeletedHandle );
+        FCoreUObjectDelegates::OnObjectPropertyChanged.Remove( WorldOutlinerObjectPropertyChangedHandle );
+        FEditorDelegates::PostUndoRedo.Remove( WorldOutlinerUndoRedoHandle );
+    }
+
+    ClearWorldOutlinerComponentTracking();
+
+    if ( LandscapeInputObjectModifiedHandle.IsValid() )
+        FCoreUObjectDelegates::OnObjectModified.Remove( LandscapeInputObjectModifiedHandle );
+
+#endif
+
     // Destroy anything curve related.
     DestroyInputCurve();
 
@@ -1351,6 +1434,10 @@ UHoudiniAssetInput::PostLoad()
         StartWorldOutlinerTicking();
 #endif
     }
+
+#if WITH_EDITOR
+    UpdateLandscapeInputTracking();
+#endif
 	
 }
 
@@ -1409,6 +1496,7 @@ UHoudiniAssetInput::Serialize( FArchive & Ar )
     if ( Ar.IsLoading() )
     {
         bLoadedParameter = true;
+        bLandscapeInputSculpted = false;
 
         if ( Ar.IsTransacting() )
         {
@@ -1652,6 +1740,9 @@ UHoudiniAssetInput::ChangeInputType(const EHoudiniAssetInputType::Enum& newType)
 
             // Reset selected landscape.
             InputLandscapeProxy = nullptr;
+
+            // Stop tracking landscape changes.
+            UpdateLandscapeInputTracking();
             break;
         }
 
@@ -1736,7 +1827,8 @@ UHoudiniAssetInput::ChangeInputType(const EHoudiniAssetInputType::Enum& newType)
             // Force recook and reconnect of the input assets.
             HAPI_AssetId HostAssetId = HoudiniAssetComponent->GetAssetId();
             FHoudiniEngineUtils::HapiCreateAndConnectAsset(
-                HostAssetId, InputIndex, InputOutlinerMeshArray, ConnectedAssetId, UnrealSplineResolution );
+                HostAssetId, InputIndex, InputOutlinerMeshArray, ConnectedAssetId,
+                InputOutlinerMergeAssetIds, UnrealSplineResolution );
 
             break;
         }
@@ -1884,6 +1976,10 @@ UHoudiniAssetInput::OnLandscapeActorSelected( AActor * Actor )
         InputLandscapeProxy = nullptr;
     }
 
+    // Changes made to the previous landscape are irrelevant, the new one is fully exported.
+    LandscapeInputDirtyComponents.Empty();
+    UpdateLandscapeInputTracking();
+
     MarkPreChanged();
     MarkChanged();
 }
@@ -1919,30 +2015,34 @@ UHoudiniAssetInput::TickWorldOutlinerInputs()
 
             // Mark mesh for deletion.
             InputOutlinerMeshArrayPendingKill.Add( OutlinerMesh.StaticMeshComponent );
+
+            // The remaining actors need to be reconnected to their new slots.
+            bStaticMeshChanged = true;
         }
-        else if ( OutlinerMesh.HasActorTransformChanged() && (OutlinerMesh.AssetId >= 0))
+        else if ( OutlinerMesh.HasSplineComponentChanged( UnrealSplineResolution ) )
         {
-            if (!bLocalChanged)
+            if ( !bLocalChanged )
             {
                 Modify();
                 MarkPreChanged();
                 bLocalChanged = true;
             }
 
-            // Updates to the new Transform
+            // Update to the new Transforms
             UpdateWorldOutlinerTransforms(OutlinerMesh);
 
-	    // Apply it to the asset
-            HAPI_TransformEuler HapiTransform;
-            FHoudiniEngineUtils::TranslateUnrealTransform(OutlinerMesh.ComponentTransform, HapiTransform);
+            // The spline has been modified, only its asset needs to be rebuilt in UploadParameterValue().
+            if ( FHoudiniEngineUtils::IsValidAssetId( OutlinerMesh.AssetId ) )
+            {
+                FHoudiniEngineUtils::DestroyHoudiniAsset( OutlinerMesh.AssetId );
+                OutlinerMesh.AssetId = -1;
+            }
 
-	    FHoudiniApi::SetAssetTransform(
-                FHoudiniEngine::Get().GetSession(),
-		OutlinerMesh.AssetId, &HapiTransform);
+            bStaticMeshChanged = true;
         }
-        else if ( OutlinerMesh.HasComponentTransformChanged() 
-                || OutlinerMesh.HasSplineComponentChanged(UnrealSplineResolution)
-                || (OutlinerMesh.KeepWorldTransform != bKeepWorldTransform) )
+        else if ( OutlinerMesh.HasActorTransformChanged()
+                || OutlinerMesh.HasComponentTransformChanged()
+                || ( OutlinerMesh.KeepWorldTransform != bKeepWorldTransform ) )
         {
             if ( !bLocalChanged )
             {
@@ -1951,12 +2051,23 @@ UHoudiniAssetInput::TickWorldOutlinerInputs()
                 bLocalChanged = true;
             }
 
-            // Update to the new Transforms
+            // Updates to the new Transform
             UpdateWorldOutlinerTransforms(OutlinerMesh);
 
-            // The component or spline has been modified so so we need to indicate that the "static mesh" 
-            // has changed in order to rebuild the asset properly in UploadParameterValue()
-            bStaticMeshChanged = true;
+            // Apply it to the asset, the geometry itself did not change.
+            if ( FHoudiniEngineUtils::IsValidAssetId( OutlinerMesh.AssetId ) )
+            {
+                HAPI_TransformEuler HapiTransform;
+                FHoudiniEngineUtils::TranslateUnrealTransform( OutlinerMesh.ComponentTransform, HapiTransform );
+
+                FHoudiniApi::SetAssetTransform(
+                    FHoudiniEngine::Get().GetSession(),
+                    OutlinerMesh.AssetId, &HapiTransform );
+            }
+            else
+            {
+                bStaticMeshChanged = true;
+            }
         }
     }
 
@@ -1973,6 +2084,8 @@ UHoudiniAssetInput::TickWorldOutlinerInputs()
             } );
         }
 
+        UpdateWorldOutlinerComponentTracking();
+
 	MarkChanged();
     }
 }
@@ -2117,6 +2230,15 @@ UHoudiniAssetInput::GetConnectedInputAssetComponent()
     return InputAssetComponent;
 }
 
+void
+UHoudiniAssetInput::MarkPreChanged( bool bMarkAndTriggerUpdate )
+{
+    // Only sculpting and painting can be uploaded in place, see TickLandscapeInput.
+    bLandscapeInputSculpted = false;
+
+    Super::MarkPreChanged( bMarkAndTriggerUpdate );
+}
+
 void
 UHoudiniAssetInput::NotifyChildParameterChanged( UHoudiniAssetParameter * HoudiniAssetParameter )
 {
@@ -2349,6 +2471,7 @@ UHoudiniAssetInput::CheckStateChangedExportOnlySelected( ECheckBoxState NewState
         MarkPreChanged();
 
         bLandscapeInputSelectionOnly = bState;
+        UpdateLandscapeInputTracking();
 
         // Mark this parameter as changed.
         MarkChanged();
@@ -2557,6 +2680,39 @@ UHoudiniAssetInput::IsCheckedExportTileUVs() const
     return ECheckBoxState::Unchecked;
 }
 
+void
+UHoudiniAssetInput::CheckStateChangedExportAsHeightfield( ECheckBoxState NewState )
+{
+    int32 bState = ( NewState == ECheckBoxState::Checked );
+
+    if ( bLandscapeExportAsHeightfield != bState )
+    {
+        // Record undo information.
+        FScopedTransaction Transaction(
+            TEXT( HOUDINI_MODULE_RUNTIME ),
+            LOCTEXT( "HoudiniInputChange", "Houdini Export Landscape As Heightfield mode change." ),
+            HoudiniAssetComponent );
+        Modify();
+
+        MarkPreChanged();
+
+        bLandscapeExportAsHeightfield = bState;
+        UpdateLandscapeInputTracking();
+
+        // Mark this parameter as changed.
+        MarkChanged();
+    }
+}
+
+ECheckBoxState
+UHoudiniAssetInput::IsCheckedExportAsHeightfield() const
+{
+    if ( bLandscapeExportAsHeightfield )
+        return ECheckBoxState::Checked;
+
+    return ECheckBoxState::Unchecked;
+}
+
 
 void
 UHoudiniAssetInput::CheckStateChangedKeepWorldTransform(ECheckBoxState NewState)
@@ -2604,6 +2760,9 @@ UHoudiniAssetInput::OnButtonClickRecommit()
 {
     // There's no undo operation for button.
 
+    // A recommit always exports the whole landscape.
+    LandscapeInputDirtyComponents.Empty();
+
     MarkPreChanged();
     MarkChanged();
 
@@ -2668,11 +2827,28 @@ UHoudiniAssetInput::OnButtonClickSelectActors()
     MarkPreChanged();
     bStaticMeshChanged = true;
 
-    // Delete all assets and reset the array.
-    // TODO: Make this process a little more efficient.
-    DisconnectAndDestroyInputAsset();
+    // Components which stay selected keep their input assets, the assets of the others are destroyed below.
+    TArray< FHoudiniAssetInputOutlinerMesh > PreviousOutlinerMeshArray = MoveTemp( InputOutlinerMeshArray );
     InputOutlinerMeshArray.Empty();
 
+    auto ReusePreviousOutlinerMesh = [ & ]( UStaticMeshComponent * StaticMeshComponent, USplineComponent * SplineComponent )
+    {
+        for ( int32 Idx = 0; Idx < PreviousOutlinerMeshArray.Num(); ++Idx )
+        {
+            const FHoudiniAssetInputOutlinerMesh & PreviousOutlinerMesh = PreviousOutlinerMeshArray[ Idx ];
+            if ( PreviousOutlinerMesh.StaticMeshComponent == StaticMeshComponent
+                && PreviousOutlinerMesh.SplineComponent == SplineComponent
+                && ( !StaticMeshComponent || PreviousOutlinerMesh.StaticMesh == StaticMeshComponent->GetStaticMesh() ) )
+            {
+                InputOutlinerMeshArray.Add( PreviousOutlinerMesh );
+                PreviousOutlinerMeshArray.RemoveAtSwap( Idx );
+                return true;
+            }
+        }
+
+        return false;
+    };
+
     USelection * SelectedActors = GEditor->GetSelectedActors();
 
     // If the builder brush is selected, first deselect it.
@@ -2697,6 +2873,9 @@ UHoudiniAssetInput::OnButtonClickSelectActors()
             if ( !StaticMesh )
                 continue;
 
+            if ( ReusePreviousOutlinerMesh( StaticMeshComponent, nullptr ) )
+                continue;
+
 	    // Add the mesh to the array
 	    FHoudiniAssetInputOutlinerMesh OutlinerMesh;
 
@@ -2718,6 +2897,9 @@ UHoudiniAssetInput::OnButtonClickSelectActors()
 	    if (!SplineComponent)
 		continue;
 
+	    if ( ReusePreviousOutlinerMesh( nullptr, SplineComponent ) )
+		continue;
+
 	    // Add the spline to the array
 	    FHoudiniAssetInputOutlinerMesh OutlinerMesh;
 
@@ -2733,6 +2915,13 @@ UHoudiniAssetInput::OnButtonClickSelectActors()
 	}
     }
 
+    // Destroy the assets of the components which are no longer selected.
+    for ( auto & PreviousOutlinerMesh : PreviousOutlinerMeshArray )
+    {
+        if ( FHoudiniEngineUtils::IsValidAssetId( PreviousOutlinerMesh.AssetId ) )
+            FHoudiniEngineUtils::DestroyHoudiniAsset( PreviousOutlinerMesh.AssetId );
+    }
+
     MarkChanged();
 
     AHoudiniAssetActor * HoudiniAssetActor = HoudiniAssetComponent->GetHoudiniAssetActorOwner();
@@ -2774,10 +2963,23 @@ UHoudiniAssetInput::StartWorldOutlinerTicking()
     {
         WorldOutlinerTimerDelegate = FTimerDelegate::CreateUObject( this, &UHoudiniAssetInput::TickWorldOutlinerInputs );
 
-        // We need to register delegate with the timer system.
-        static const float TickTimerDelay = 0.5f;
-        GEditor->GetTimerManager()->SetTimer( WorldOutlinerTimerHandle, WorldOutlinerTimerDelegate, TickTimerDelay, true );
+        // Input Actors are only checked when the editor reports a change which may concern them.
+        WorldOutlinerActorMovedHandle =
+            GEngine->OnActorMoved().AddUObject( this, &UHoudiniAssetInput::OnWorldOutlinerActorMoved );
+        WorldOutlinerActorDeletedHandle =
+            GEngine->OnLevelActorDeleted().AddUObject( this, &UHoudiniAssetInput::OnWorldOutlinerActorDeleted );
+        WorldOutlinerObjectPropertyChangedHandle =
+            FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject( this, &UHoudiniAssetInput::OnWorldOutlinerObjectPropertyChanged );
+        WorldOutlinerUndoRedoHandle =
+            FEditorDelegates::PostUndoRedo.AddUObject( this, &UHoudiniAssetInput::OnWorldOutlinerUndoRedo );
+
+        // Catch up with changes made while we were not listening.
+        ScheduleWorldOutlinerUpdate();
     }
+
+    // The input Actors may have changed since we started listening.
+    if ( WorldOutlinerTimerDelegate.IsBound() )
+        UpdateWorldOutlinerComponentTracking();
 }
 
 void
@@ -2787,12 +2989,248 @@ UHoudiniAssetInput::StopWorldOutlinerTicking()
     {
         GEditor->GetTimerManager()->ClearTimer( WorldOutlinerTimerHandle );
         WorldOutlinerTimerDelegate.Unbind();
+
+        GEngine->OnActorMoved().Remove( WorldOutlinerActorMovedHandle );
+        GEngine->OnLevelActorDeleted().Remove( WorldOutlinerActorDeletedHandle );
+        FCoreUObjectDelegates::OnObjectPropertyChanged.Remove( WorldOutlinerObjectPropertyChangedHandle );
+        FEditorDelegates::PostUndoRedo.Remove( WorldOutlinerUndoRedoHandle );
+
+        WorldOutlinerActorMovedHandle.Reset();
+        WorldOutlinerActorDeletedHandle.Reset();
+        WorldOutlinerObjectPropertyChangedHandle.Reset();
+        WorldOutlinerUndoRedoHandle.Reset();
+
+        ClearWorldOutlinerComponentTracking();
     }
 }
 
+bool
+UHoudiniAssetInput::IsWorldOutlinerInputObject( const UObject * Object ) const
+{
+    if ( !Object )
+        return false;
+
+    const AActor * Actor = Cast< AActor >( Object );
+    if ( !Actor )
+    {
+        if ( const UActorComponent * ActorComponent = Cast< UActorComponent >( Object ) )
+            Actor = ActorComponent->GetOwner();
+    }
+
+    if ( !Actor )
+        return false;
+
+    // Moving an Actor also moves the input Actors attached to it.
+    for ( const auto & OutlinerMesh : InputOutlinerMeshArray )
+    {
+        if ( OutlinerMesh.Actor == Actor || ( OutlinerMesh.Actor && OutlinerMesh.Actor->IsAttachedTo( Actor ) ) )
+            return true;
+    }
+
+    return false;
+}
+
+void
+UHoudiniAssetInput::ScheduleWorldOutlinerUpdate()
+{
+    if ( !GEditor || !WorldOutlinerTimerDelegate.IsBound() )
+        return;
+
+    // All changes reported until the timer fires are handled by a single check, and a single upload.
+    if ( !GEditor->GetTimerManager()->IsTimerActive( WorldOutlinerTimerHandle ) )
+    {
+        static const float UpdateTimerDelay = 0.1f;
+        GEditor->GetTimerManager()->SetTimer( WorldOutlinerTimerHandle, WorldOutlinerTimerDelegate, UpdateTimerDelay, false );
+    }
+}
+
+void
+UHoudiniAssetInput::OnWorldOutlinerActorMoved( AActor * Actor )
+{
+    if ( IsWorldOutlinerInputObject( Actor ) )
+        ScheduleWorldOutlinerUpdate();
+}
+
+void
+UHoudiniAssetInput::OnWorldOutlinerActorDeleted( AActor * Actor )
+{
+    if ( IsWorldOutlinerInputObject( Actor ) )
+        ScheduleWorldOutlinerUpdate();
+}
+
+void
+UHoudiniAssetInput::OnWorldOutlinerObjectPropertyChanged( UObject * Object, FPropertyChangedEvent & PropertyChangedEvent )
+{
+    // Covers transforms edited in the details panel and spline edits.
+    if ( IsWorldOutlinerInputObject( Object ) )
+        ScheduleWorldOutlinerUpdate();
+}
+
+void
+UHoudiniAssetInput::OnWorldOutlinerUndoRedo()
+{
+    // Undo and redo restore Actors without reporting them as moved, the tick finds out what changed.
+    UpdateWorldOutlinerComponentTracking();
+    ScheduleWorldOutlinerUpdate();
+}
+
+void
+UHoudiniAssetInput::OnWorldOutlinerComponentTransformUpdated(
+    USceneComponent * Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport )
+{
+    // Also fires while dragging, for attached children, and for moves made by Sequencer, Blueprints or code.
+    ScheduleWorldOutlinerUpdate();
+}
+
+void
+UHoudiniAssetInput::UpdateWorldOutlinerComponentTracking()
+{
+    TSet< USceneComponent * > TrackedComponents;
+    for ( const auto & OutlinerMesh : InputOutlinerMeshArray )
+    {
+        if ( OutlinerMesh.Actor && !OutlinerMesh.Actor->IsPendingKill() && OutlinerMesh.Actor->GetRootComponent() )
+            TrackedComponents.Add( OutlinerMesh.Actor->GetRootComponent() );
+
+        if ( OutlinerMesh.StaticMeshComponent && !OutlinerMesh.StaticMeshComponent->IsPendingKill() )
+            TrackedComponents.Add( OutlinerMesh.StaticMeshComponent );
+
+        if ( OutlinerMesh.SplineComponent && !OutlinerMesh.SplineComponent->IsPendingKill() )
+            TrackedComponents.Add( OutlinerMesh.SplineComponent );
+    }
+
+    // Unbind the components which are no longer used.
+    for ( auto Iter = WorldOutlinerComponentHandles.CreateIterator(); Iter; ++Iter )
+    {
+        USceneComponent * Component = Iter.Key().Get();
+        if ( Component && TrackedComponents.Contains( Component ) )
+            continue;
+
+        if ( Component )
+            Component->TransformUpdated.Remove( Iter.Value() );
+
+        Iter.RemoveCurrent();
+    }
+
+    for ( USceneComponent * Component : TrackedComponents )
+    {
+        if ( !WorldOutlinerComponentHandles.Contains( Component ) )
+        {
+            WorldOutlinerComponentHandles.Add(
+                Component,
+                Component->TransformUpdated.AddUObject( this, &UHoudiniAssetInput::OnWorldOutlinerComponentTransformUpdated ) );
+        }
+    }
+}
+
+void
+UHoudiniAssetInput::ClearWorldOutlinerComponentTracking()
+{
+    for ( auto & ComponentHandle : WorldOutlinerComponentHandles )
+    {
+        if ( USceneComponent * Component = ComponentHandle.Key.Get() )
+            Component->TransformUpdated.Remove( ComponentHandle.Value );
+    }
+
+    WorldOutlinerComponentHandles.Empty();
+}
+
+void
+UHoudiniAssetInput::UpdateLandscapeInputTracking()
+{
+    // Only heightfield volumes can be updated in place, other landscape exports are still made on demand.
+    const bool bTrackLandscape = ChoiceIndex == EHoudiniAssetInputType::LandscapeInput && InputLandscapeProxy
+        && bLandscapeExportAsHeightfield && !bLandscapeInputSelectionOnly;
+
+    if ( bTrackLandscape && !LandscapeInputObjectModifiedHandle.IsValid() )
+    {
+        LandscapeInputObjectModifiedHandle =
+            FCoreUObjectDelegates::OnObjectModified.AddUObject( this, &UHoudiniAssetInput::OnLandscapeInputObjectModified );
+    }
+    else if ( !bTrackLandscape && LandscapeInputObjectModifiedHandle.IsValid() )
+    {
+        FCoreUObjectDelegates::OnObjectModified.Remove( LandscapeInputObjectModifiedHandle );
+        LandscapeInputObjectModifiedHandle.Reset();
+
+        if ( GEditor )
+            GEditor->GetTimerManager()->ClearTimer( LandscapeInputTimerHandle );
+
+        LandscapeInputDirtyComponents.Empty();
+    }
+}
+
+void
+UHoudiniAssetInput::OnLandscapeInputObjectModified( UObject * Object )
+{
+    if ( !Object || !InputLandscapeProxy || !GEditor )
+        return;
+
+    // Landscape tools modify the components they edit, as well as their height and weight map textures.
+    ULandscapeComponent * LandscapeComponent = Cast< ULandscapeComponent >( Object );
+    if ( LandscapeComponent )
+    {
+        if ( LandscapeComponent->GetLandscapeProxy() != InputLandscapeProxy )
+            return;
+
+        LandscapeInputDirtyComponents.Add( LandscapeComponent );
+    }
+    else
+    {
+        UTexture2D * Texture = Cast< UTexture2D >( Object );
+        if ( !Texture )
+            return;
+
+        bool bFoundComponent = false;
+        for ( ULandscapeComponent * ProxyComponent : InputLandscapeProxy->LandscapeComponents )
+        {
+            if ( ProxyComponent && ( ProxyComponent->HeightmapTexture == Texture
+                || ProxyComponent->WeightmapTextures.Contains( Texture ) ) )
+            {
+                LandscapeInputDirtyComponents.Add( ProxyComponent );
+                bFoundComponent = true;
+            }
+        }
+
+        if ( !bFoundComponent )
+            return;
+    }
+
+    // Objects are modified before being changed, and repeatedly during a stroke: the upload is made a little
+    // later, and all the changes reported until then are uploaded together.
+    if ( !GEditor->GetTimerManager()->IsTimerActive( LandscapeInputTimerHandle ) )
+    {
+        static const float UpdateTimerDelay = 0.1f;
+        GEditor->GetTimerManager()->SetTimer(
+            LandscapeInputTimerHandle, FTimerDelegate::CreateUObject( this, &UHoudiniAssetInput::TickLandscapeInput ),
+            UpdateTimerDelay, false );
+    }
+}
+
+void
+UHoudiniAssetInput::TickLandscapeInput()
+{
+    // Drop the components which have been deleted since they were changed.
+    for ( auto Iter = LandscapeInputDirtyComponents.CreateIterator(); Iter; ++Iter )
+    {
+        if ( !Iter->IsValid() )
+            Iter.RemoveCurrent();
+    }
+
+    if ( LandscapeInputDirtyComponents.Num() <= 0 )
+        return;
+
+    // Upload is done by UploadParameterValue, which only re-exports the dirty components if nothing else
+    // changed since the last upload. Changes made after this one go through MarkPreChanged and clear the flag.
+    const bool bOnlySculpted = !HasChanged();
+    MarkPreChanged();
+    bLandscapeInputSculpted = bOnlySculpted;
+    MarkChanged();
+}
+
 void UHoudiniAssetInput::InvalidateNodeIds()
 {
     ConnectedAssetId = -1;
+    InputOutlinerMergeAssetIds.Empty();
+    LandscapeInputVolumeAssetIds.Empty();
     for (auto& OutlinerInputMesh : InputOutlinerMeshArray)
     {
         OutlinerInputMesh.AssetId = -1;
@@ -2847,7 +3285,17 @@ UHoudiniAssetInput::RemoveWorldOutlinerInput( int32 AtIndex )
 
     MarkPreChanged();
     bStaticMeshChanged = true;
+
+    // Only the removed actor's asset is destroyed, the other actors are kept.
+    if ( FHoudiniEngineUtils::IsValidAssetId( InputOutlinerMeshArray[ AtIndex ].AssetId ) )
+    {
+        FHoudiniEngineUtils::DestroyHoudiniAsset( InputOutlinerMeshArray[ AtIndex ].AssetId );
+        InputOutlinerMeshArray[ AtIndex ].AssetId = -1;
+    }
+
     InputOutlinerMeshArray.RemoveAt( AtIndex );
+    UpdateWorldOutlinerComponentTracking();
+
     MarkChanged();
 }
 
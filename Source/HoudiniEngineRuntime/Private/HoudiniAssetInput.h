@@ -34,6 +34,7 @@
 #include "HoudiniAssetInput.generated.h"
 
 class ALandscapeProxy;
+class ULandscapeComponent;
 class UHoudiniSplineComponent;
 class USplineComponent;
 
@@ -252,6 +253,43 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Check if input Actors have had their Transforms changed. **/
         void TickWorldOutlinerInputs();
 
+        /** Return true if this Actor, or the Actor owning this component, is used by the world outliner input. **/
+        bool IsWorldOutlinerInputObject( const UObject * Object ) const;
+
+        /** Schedule a single check of the world outliner input Actors, repeated requests are coalesced. **/
+        void ScheduleWorldOutlinerUpdate();
+
+        /** Called when an Actor has been moved in the editor. **/
+        void OnWorldOutlinerActorMoved( AActor * Actor );
+
+        /** Called when an Actor has been deleted from the level. **/
+        void OnWorldOutlinerActorDeleted( AActor * Actor );
+
+        /** Called when a property of an object has been changed in the editor. **/
+        void OnWorldOutlinerObjectPropertyChanged( UObject * Object, FPropertyChangedEvent & PropertyChangedEvent );
+
+        /** Called after an editor transaction has been undone or redone. **/
+        void OnWorldOutlinerUndoRedo();
+
+        /** Called whenever the transform of a component of an input Actor is updated, from any source. **/
+        void OnWorldOutlinerComponentTransformUpdated(
+            USceneComponent * Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport );
+
+        /** Bind the transform update delegates of the components used by the input Actors, unbind the stale ones. **/
+        void UpdateWorldOutlinerComponentTracking();
+
+        /** Unbind the transform update delegates of all tracked components. **/
+        void ClearWorldOutlinerComponentTracking();
+
+        /** Start or stop tracking the changes made to the landscape, depending on the current input settings. **/
+        void UpdateLandscapeInputTracking();
+
+        /** Called when an object is about to be modified, used to collect the changed landscape components. **/
+        void OnLandscapeInputObjectModified( UObject * Object );
+
+        /** Upload the changes made to the landscape since the last upload. **/
+        void TickLandscapeInput();
+
         /** Update WorldOutliners Transform after they changed **/
         void UpdateWorldOutlinerTransforms(FHoudiniAssetInputOutlinerMesh& OutlinerMesh);
 
@@ -267,6 +305,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
 
     protected:
 
+        /** Mark this input as pre-changed, the change is not one which can be uploaded as landscape tiles. **/
+        virtual void MarkPreChanged( bool bMarkAndTriggerUpdate = true );
+
         /** Connect the input asset in Houdini. **/
         void ConnectInputAssetActor();
 
@@ -362,6 +403,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Return checked state of landscape tile uv checkbox. **/
         ECheckBoxState IsCheckedExportTileUVs() const;
 
+        /** Check if state of landscape heightfield checkbox has changed. **/
+        void CheckStateChangedExportAsHeightfield( ECheckBoxState NewState );
+
+        /** Return checked state of landscape heightfield checkbox. **/
+        ECheckBoxState IsCheckedExportAsHeightfield() const;
+
         /** Check if state of the transform type checkbox has changed. **/
         void CheckStateChangedKeepWorldTransform(ECheckBoxState NewState);
 
@@ -374,10 +421,10 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Handler for World Outliner input selection button. **/
         FReply OnButtonClickSelectActors();
 
-        /** Start world outliner Actor transform monitor ticking. **/
+        /** Start listening to editor events which may change the world outliner input Actors. **/
         void StartWorldOutlinerTicking();
 
-        /** Stop world outliner Actor transform monitor ticking. **/
+        /** Stop listening to editor events for the world outliner input Actors. **/
         void StopWorldOutlinerTicking();
 
         /** Set value of the SplineResolution for world outliners, used by Slate. **/
@@ -415,9 +462,19 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Id of currently connected asset. **/
         HAPI_AssetId ConnectedAssetId;
 
+        /** The ids of the assets connected to each slot of the merge asset for WorldInput mode. **/
+        TArray< HAPI_AssetId > InputOutlinerMergeAssetIds;
+
         /** The ids of the assets connected to the input for GeometryInput mode */
         TArray< HAPI_NodeId > GeometryInputAssetIds;
 
+        /** The ids of the heightfield volume assets merged for LandscapeInput mode. **/
+        TArray< HAPI_AssetId > LandscapeInputVolumeAssetIds;
+
+        /** Landscape components changed since the heightfield volumes were last uploaded. Components may be **/
+        /** deleted or garbage collected before the upload, they are not kept alive by this set.             **/
+        TSet< TWeakObjectPtr< ULandscapeComponent > > LandscapeInputDirtyComponents;
+
         /** Index of this input. **/
         int32 InputIndex;
 
@@ -430,6 +487,21 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Timer delegate, we use it for ticking to see if input Actors have changed. **/
         FTimerDelegate WorldOutlinerTimerDelegate;
 
+        /** Handles of the editor event delegates used to detect changes of input Actors. **/
+        FDelegateHandle WorldOutlinerActorMovedHandle;
+        FDelegateHandle WorldOutlinerActorDeletedHandle;
+        FDelegateHandle WorldOutlinerObjectPropertyChangedHandle;
+        FDelegateHandle WorldOutlinerUndoRedoHandle;
+
+        /** Components of the input Actors whose transform updates are tracked, with their delegate handles. **/
+        TMap< TWeakObjectPtr< USceneComponent >, FDelegateHandle > WorldOutlinerComponentHandles;
+
+        /** Timer handle, this timer coalesces the landscape changes into a single upload. **/
+        FTimerHandle LandscapeInputTimerHandle;
+
+        /** Handle of the object modified delegate used to detect changes of the input landscape. **/
+        FDelegateHandle LandscapeInputObjectModifiedHandle;
+
         float UnrealSplineResolution;
 
         /** Flags used by this input. **/
@@ -472,6 +544,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
 
                 /** Is set to true when this input's Transform Type is set to NONE, 2 will use the input's default value **/
                 uint32 bKeepWorldTransform : 2;
+
+                /** Is set to true when the landscape is exported as heightfield volumes instead of a mesh. **/
+                uint32 bLandscapeExportAsHeightfield : 1;
+
+                /** Is set to true when the pending upload was only caused by sculpting or painting the landscape. **/
+                uint32 bLandscapeInputSculpted : 1;
             };
 
             uint32 HoudiniAssetInputFlagsPacked;
@@ -628,7 +628,6 @@ UHoudiniAssetInstance::HapiGetObjectTransforms( TArray< FTransform > & ObjectTra
     {
         TArray< HAPI_Transform > HapiObjectTransforms;
         HapiObjectTransforms.SetNumUninitialized( AssetInfo.objectCount );
-        ObjectTransforms.SetNumUninitialized( AssetInfo.objectCount );
 
         if ( FHoudiniApi::GetObjectTransforms(
             FHoudiniEngine::Get().GetSession(), AssetId,
@@ -637,8 +636,7 @@ UHoudiniAssetInstance::HapiGetObjectTransforms( TArray< FTransform > & ObjectTra
             return false;
         }
 
-        for ( int32 Idx = 0; Idx < AssetInfo.objectCount; ++Idx )
-            FHoudiniEngineUtils::TranslateHapiTransform( HapiObjectTransforms[ Idx ], ObjectTransforms[ Idx ] );
+        FHoudiniEngineUtils::TranslateHapiTransforms( HapiObjectTransforms, ObjectTransforms );
     }
 
     return true;
@@ -139,9 +139,52 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
 
     HAPI_AssetId AssetId = HoudiniAssetComponent->GetAssetId();
 
-    // Retrieve instance transforms (for each point).
+    // Retrieve instance transforms (for each point), packed primitive instancers retrieve their own.
     TArray< FTransform > AllTransforms;
-    HoudiniGeoPartObject.HapiGetInstanceTransforms( AssetId, AllTransforms );
+    TArray< int32 > AllInstanceIds;
+    if ( !bIsPackedPrimitiveInstancer )
+    {
+        HoudiniGeoPartObject.HapiGetInstanceTransforms( AssetId, AllTransforms );
+
+        // Retrieve stable instance ids (for each point), used to update only the instances which have changed.
+        HAPI_AttributeInfo InstanceIdAttributeInfo;
+        if ( !HoudiniGeoPartObject.HapiGetAttributeDataAsInt(
+                AssetId, HAPI_UNREAL_ATTRIB_INSTANCE_ID, HAPI_ATTROWNER_POINT,
+                InstanceIdAttributeInfo, AllInstanceIds, 1 )
+            || !InstanceIdAttributeInfo.exists || AllInstanceIds.Num() != AllTransforms.Num() )
+        {
+            AllInstanceIds.Empty();
+        }
+    }
+
+    // Hierarchical instancing may be used, unless the instancer overrides the setting with a detail attribute.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    bIsHierarchicalInstancer = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bUseHierarchicalInstancing;
+    {
+        HAPI_AttributeInfo HierarchicalInstancingAttributeInfo;
+        TArray< int32 > HierarchicalInstancing;
+        if ( HoudiniGeoPartObject.HapiGetAttributeDataAsInt(
+                AssetId, HAPI_UNREAL_ATTRIB_HIERARCHICAL_INSTANCING, HAPI_ATTROWNER_DETAIL,
+                HierarchicalInstancingAttributeInfo, HierarchicalInstancing, 1 )
+            && HierarchicalInstancingAttributeInfo.exists && HierarchicalInstancing.Num() > 0 )
+        {
+            bIsHierarchicalInstancer = HierarchicalInstancing[ 0 ] != 0;
+        }
+    }
+
+    // Foliage output works the same way, with its own setting and detail attribute.
+    bIsFoliageInstancer = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bOutputInstancersToFoliage;
+    {
+        HAPI_AttributeInfo FoliageAttributeInfo;
+        TArray< int32 > Foliage;
+        if ( HoudiniGeoPartObject.HapiGetAttributeDataAsInt(
+                AssetId, HAPI_UNREAL_ATTRIB_FOLIAGE, HAPI_ATTROWNER_DETAIL,
+                FoliageAttributeInfo, Foliage, 1 )
+            && FoliageAttributeInfo.exists && Foliage.Num() > 0 )
+        {
+            bIsFoliageInstancer = Foliage[ 0 ] != 0;
+        }
+    }
 
     // List of new fields. Reused input fields will also be placed here.
     TArray< UHoudiniAssetInstanceInputField * > NewInstanceInputFields;
@@ -155,13 +198,6 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
             FHoudiniEngine::Get().GetSession(), AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.GeoId, HoudiniGeoPartObject.PartId,
             &PartInfo ), false );
 
-        // Retrieve part name.
-        FString PartName;
-        FHoudiniEngineString HoudiniEngineStringPartName( PartInfo.nameSH );
-        HoudiniEngineStringPartName.ToFString( PartName );
-
-        //HOUDINI_LOG_MESSAGE( TEXT( "Part Instancer (%s): IPC=%d, IC=%d" ), *PartName, PartInfo.instancedPartCount, PartInfo.instanceCount );
-
         // Get transforms for each instance
         TArray<HAPI_Transform> InstancerPartTransforms;
         InstancerPartTransforms.SetNumZeroed( PartInfo.instanceCount );
@@ -169,6 +205,10 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
             FHoudiniEngine::Get().GetSession(), AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.GeoId, PartInfo.id,
             HAPI_RSTORDER_DEFAULT, InstancerPartTransforms.GetData(), 0, PartInfo.instanceCount ), false );
 
+        // All instanced parts share the instancer transforms, convert them only once.
+        TArray<FTransform> ObjectTransforms;
+        FHoudiniEngineUtils::TranslateHapiTransforms( InstancerPartTransforms, ObjectTransforms );
+
         // Get the part ids for parts being instanced
         TArray<HAPI_PartId> InstancedPartIds;
         InstancedPartIds.SetNumZeroed( PartInfo.instancedPartCount );
@@ -176,39 +216,27 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
             FHoudiniEngine::Get().GetSession(), AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.GeoId, PartInfo.id,
             InstancedPartIds.GetData(), 0, PartInfo.instancedPartCount ), false );
 
+        const TArray< int32 > NoInstanceIds;
         for ( auto InstancedPartId : InstancedPartIds )
         {
-            HAPI_PartInfo InstancedPartInfo;
-            HOUDINI_CHECK_ERROR_RETURN(
-                FHoudiniApi::GetPartInfo(
-                    FHoudiniEngine::Get().GetSession(), AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.GeoId, InstancedPartId,
-                    &InstancedPartInfo ), false );
-
-            TArray<FTransform> ObjectTransforms;
-            ObjectTransforms.SetNumUninitialized( InstancerPartTransforms.Num() );
-            for ( int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); ++InstanceIdx )
-            {
-                const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
-                FHoudiniEngineUtils::TranslateHapiTransform( InstanceTransform, ObjectTransforms[InstanceIdx] );
-                //HOUDINI_LOG_MESSAGE( TEXT( "Instance %d:%d Transform: %s for Part Id %d" ), HoudiniGeoPartObject.PartId, InstanceIdx, *ObjectTransforms[ InstanceIdx ].ToString(), InstancedPartId );
-            }
-
             // Create this instanced input field for this instanced part
             //
             FHoudiniGeoPartObject InstancedPart( HoudiniGeoPartObject.AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.GeoId, InstancedPartId );
             InstancedPart.TransformMatrix = HoudiniGeoPartObject.TransformMatrix;
-            CreateInstanceInputField( InstancedPart, ObjectTransforms, InstanceInputFields, NewInstanceInputFields );
+            CreateInstanceInputField(
+                InstancedPart, ObjectTransforms, NoInstanceIds, InstanceInputFields, NewInstanceInputFields );
         }
     }
     else if ( bIsAttributeInstancer )
     {
         HAPI_AttributeInfo ResultAttributeInfo;
-        TArray< FString > PointInstanceValues;
+        TArray< FString > UniquePointInstanceValues;
+        TArray< int32 > PointInstanceValueIndices;
 
-        if( !HoudiniGeoPartObject.HapiGetAttributeDataAsString(
+        if( !HoudiniGeoPartObject.HapiGetAttributeDataAsUniqueStrings(
             AssetId, HAPI_UNREAL_ATTRIB_INSTANCE,
             HAPI_ATTROWNER_POINT, ResultAttributeInfo,
-            PointInstanceValues ) )
+            UniquePointInstanceValues, PointInstanceValueIndices ) )
         {
             // This should not happen - attribute exists, but there was an error retrieving it.
             return false;
@@ -217,24 +245,18 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
         // Instance attribute exists on points.
 
         // Number of points must match number of transforms.
-        if ( PointInstanceValues.Num() != AllTransforms.Num() )
+        if ( PointInstanceValueIndices.Num() != AllTransforms.Num() )
         {
             // This should not happen, we have mismatch between number of instance values and transforms.
             return false;
         }
 
-        // Get unique names.
-        TSet< FString > UniquePointInstanceValues( PointInstanceValues );
-        
         // If instance attribute exists on points, we need to get all unique values.
         TMap< FString, TArray< FHoudiniGeoPartObject > > ObjectsToInstance;
 
         // For each name, we need to retrieve corresponding geo object parts as well as sequence of geo object parts.
-        for ( TSet< FString >::TIterator IterString( UniquePointInstanceValues ); IterString; ++IterString )
-        {
-            const FString & UniqueName = *IterString;
+        for ( const FString & UniqueName : UniquePointInstanceValues )
             HoudiniAssetComponent->LocateStaticMeshes( UniqueName, ObjectsToInstance );
-        }
 
         if ( ObjectsToInstance.Num() == 0 )
         {
@@ -242,15 +264,25 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
             return false;
         }
 
-        for ( TMap< FString, TArray< FHoudiniGeoPartObject > >::TIterator IterInstanceObjects( ObjectsToInstance );
-            IterInstanceObjects; ++IterInstanceObjects )
+        // Retrieve transforms of all names at once.
+        TArray< TArray< FTransform > > PathTransforms;
+        TArray< TArray< int32 > > PathInstanceIds;
+        GetPathInstaceTransforms(
+            UniquePointInstanceValues.Num(), PointInstanceValueIndices, AllTransforms, AllInstanceIds,
+            PathTransforms, PathInstanceIds );
+
+        for ( int32 PathIdx = 0; PathIdx < UniquePointInstanceValues.Num(); ++PathIdx )
         {
-            const FString & InstancePath = IterInstanceObjects.Key();
-            TArray< FHoudiniGeoPartObject > & InstanceGeoPartObjects = IterInstanceObjects.Value();
+            TArray< FHoudiniGeoPartObject > * FoundInstanceGeoPartObjects =
+                ObjectsToInstance.Find( UniquePointInstanceValues[ PathIdx ] );
+            if ( !FoundInstanceGeoPartObjects )
+                continue;
+
+            TArray< FHoudiniGeoPartObject > & InstanceGeoPartObjects = *FoundInstanceGeoPartObjects;
 
             // Retrieve all applicable transforms for this object.
-            TArray< FTransform > ObjectTransforms;
-            GetPathInstaceTransforms( InstancePath, PointInstanceValues, AllTransforms, ObjectTransforms );
+            const TArray< FTransform > & ObjectTransforms = PathTransforms[ PathIdx ];
+            const TArray< int32 > & ObjectInstanceIds = PathInstanceIds[ PathIdx ];
             check( ObjectTransforms.Num() );
 
             for ( int32 InstanceGeoPartObjectIdx = 0; InstanceGeoPartObjectIdx < InstanceGeoPartObjects.Num();
@@ -262,7 +294,7 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
 
                 // Locate or create an input field.
                 CreateInstanceInputField(
-                    ItemHoudiniGeoPartObject, ObjectTransforms, InstanceInputFields,
+                    ItemHoudiniGeoPartObject, ObjectTransforms, ObjectInstanceIds, InstanceInputFields,
                     NewInstanceInputFields );
             }
         }
@@ -320,7 +352,7 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
             if ( AttributeObject )
             {
                 CreateInstanceInputField(
-                    AttributeObject, AllTransforms, InstanceInputFields,
+                    AttributeObject, AllTransforms, AllInstanceIds, InstanceInputFields,
                     NewInstanceInputFields );
             }
             else
@@ -330,51 +362,45 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
         }
         else if ( ResultAttributeInfo.owner == HAPI_ATTROWNER_POINT )
         {
-            TArray< FString > PointInstanceValues;
+            TArray< FString > UniquePointInstanceValues;
+            TArray< int32 > PointInstanceValueIndices;
 
-            if ( !HoudiniGeoPartObject.HapiGetAttributeDataAsString(
-                AssetId, MarshallingAttributeInstanceOverride,
-                HAPI_ATTROWNER_POINT, ResultAttributeInfo, PointInstanceValues ) )
+            if ( !HoudiniGeoPartObject.HapiGetAttributeDataAsUniqueStrings(
+                AssetId, MarshallingAttributeInstanceOverride.c_str(),
+                HAPI_ATTROWNER_POINT, ResultAttributeInfo,
+                UniquePointInstanceValues, PointInstanceValueIndices ) )
             {
                 // This should not happen - attribute exists, but there was an error retrieving it.
                 return false;
             }
 
             // Attribute is on points, number of points must match number of transforms.
-            if ( !ensure(PointInstanceValues.Num() == AllTransforms.Num()) )
+            if ( !ensure(PointInstanceValueIndices.Num() == AllTransforms.Num()) )
             {
                 // This should not happen, we have mismatch between number of instance values and transforms.
                 return false;
             }
 
-            // If instance attribute exists on points, we need to get all unique values.
-            TMap< FString, UObject * > ObjectsToInstance;
-
-            for ( auto Iter : PointInstanceValues )
-            {
-                const FString & UniqueName = *Iter;
-
-                if ( !ObjectsToInstance.Contains( UniqueName ) )
-                {
-                    UObject * AttributeObject = StaticLoadObject( 
-                        UObject::StaticClass(), nullptr, *UniqueName, nullptr, LOAD_None, nullptr );
-
-                    ObjectsToInstance.Add( UniqueName, AttributeObject );
-                }
-            }
+            // Retrieve transforms of all unique values at once.
+            TArray< TArray< FTransform > > PathTransforms;
+            TArray< TArray< int32 > > PathInstanceIds;
+            GetPathInstaceTransforms(
+                UniquePointInstanceValues.Num(), PointInstanceValueIndices, AllTransforms, AllInstanceIds,
+                PathTransforms, PathInstanceIds );
 
             bool Success = false;
 
-            for( auto Iter : ObjectsToInstance )
+            for ( int32 PathIdx = 0; PathIdx < UniquePointInstanceValues.Num(); ++PathIdx )
             {
-                const FString & InstancePath = Iter.Key;
-                UObject * AttributeObject = Iter.Value;
+                const FString & InstancePath = UniquePointInstanceValues[ PathIdx ];
+                UObject * AttributeObject = StaticLoadObject(
+                    UObject::StaticClass(), nullptr, *InstancePath, nullptr, LOAD_None, nullptr );
 
                 if ( AttributeObject )
                 {
-                    TArray< FTransform > ObjectTransforms;
-                    GetPathInstaceTransforms( InstancePath, PointInstanceValues, AllTransforms, ObjectTransforms );
-                    CreateInstanceInputField( AttributeObject, ObjectTransforms, InstanceInputFields, NewInstanceInputFields );
+                    CreateInstanceInputField(
+                        AttributeObject, PathTransforms[ PathIdx ], PathInstanceIds[ PathIdx ],
+                        InstanceInputFields, NewInstanceInputFields );
                     Success = true;
                 }
             }
@@ -405,7 +431,7 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
 
             // Locate or create an input field.
             CreateInstanceInputField(
-                ItemHoudiniGeoPartObject, AllTransforms, InstanceInputFields, NewInstanceInputFields );
+                ItemHoudiniGeoPartObject, AllTransforms, AllInstanceIds, InstanceInputFields, NewInstanceInputFields );
         }
     }
 
@@ -444,7 +470,13 @@ UHoudiniAssetInstanceInput::CleanInstanceInputFields( TArray< UHoudiniAssetInsta
     {
         UHoudiniAssetInstanceInputField * HoudiniAssetInstanceInputField = InstanceInputFields[ FieldIdx ];
         if ( HoudiniAssetInstanceInputField)
+        {
+#if WITH_EDITOR
+            // This field is no longer produced by the asset, its foliage goes away with it.
+            HoudiniAssetInstanceInputField->ClearFoliageInstances();
+#endif
             HoudiniAssetInstanceInputField->ConditionalBeginDestroy();
+        }
     }
 
     InInstanceInputFields.Empty();
@@ -454,6 +486,7 @@ void
 UHoudiniAssetInstanceInput::CreateInstanceInputField(
     const FHoudiniGeoPartObject & InHoudiniGeoPartObject,
     const TArray< FTransform > & ObjectTransforms,
+    const TArray< int32 > & ObjectInstanceIds,
     const TArray< UHoudiniAssetInstanceInputField * > & OldInstanceInputFields,
     TArray<UHoudiniAssetInstanceInputField * > & NewInstanceInputFields)
 {
@@ -498,7 +531,7 @@ UHoudiniAssetInstanceInput::CreateInstanceInputField(
         }
 
         // Set transforms for this input.
-        HoudiniAssetInstanceInputField->SetInstanceTransforms( ObjectTransforms );
+        HoudiniAssetInstanceInputField->SetInstanceTransforms( ObjectTransforms, ObjectInstanceIds );
 
         // Add field to list of fields.
         NewInstanceInputFields.Add( HoudiniAssetInstanceInputField );
@@ -509,6 +542,7 @@ void
 UHoudiniAssetInstanceInput::CreateInstanceInputField(
     UObject * InstancedObject,
     const TArray< FTransform > & ObjectTransforms,
+    const TArray< int32 > & ObjectInstanceIds,
     const TArray< UHoudiniAssetInstanceInputField * > & OldInstanceInputFields,
     TArray< UHoudiniAssetInstanceInputField * > & NewInstanceInputFields )
 {
@@ -560,7 +594,7 @@ UHoudiniAssetInstanceInput::CreateInstanceInputField(
     }
 
     // Set transforms for this input.
-    HoudiniAssetInstanceInputField->SetInstanceTransforms( ObjectTransforms );
+    HoudiniAssetInstanceInputField->SetInstanceTransforms( ObjectTransforms, ObjectInstanceIds );
 
     // Add field to list of fields.
     NewInstanceInputFields.Add( HoudiniAssetInstanceInputField );
@@ -1032,8 +1066,30 @@ UHoudiniAssetInstanceInput::IsAttributeInstancerOverride() const
     return bAttributeInstancerOverride;
 }
 
+bool
+UHoudiniAssetInstanceInput::IsHierarchicalInstancer() const
+{
+    return bIsHierarchicalInstancer;
+}
+
+bool
+UHoudiniAssetInstanceInput::IsFoliageInstancer() const
+{
+    return bIsFoliageInstancer;
+}
+
 #if WITH_EDITOR
 
+void
+UHoudiniAssetInstanceInput::ClearFoliageInstances()
+{
+    for ( UHoudiniAssetInstanceInputField * HoudiniAssetInstanceInputField : InstanceInputFields )
+    {
+        if ( HoudiniAssetInstanceInputField )
+            HoudiniAssetInstanceInputField->ClearFoliageInstances();
+    }
+}
+
 void
 UHoudiniAssetInstanceInput::CloneComponentsAndAttachToActor( AActor * Actor )
 {
@@ -1154,19 +1210,20 @@ UHoudiniAssetInstanceInput::CloneComponentsAndAttachToActor( AActor * Actor )
             }
 
             UInstancedStaticMeshComponent* DuplicatedComponent = NewObject< UInstancedStaticMeshComponent >(
-                    Actor, UInstancedStaticMeshComponent::StaticClass(), NAME_None, RF_Public );
+                    Actor, InstancedStaticMeshComponent->GetClass(), NAME_None, RF_Public );
 
             Actor->AddInstanceComponent( DuplicatedComponent );
             DuplicatedComponent->SetStaticMesh( OutStaticMesh );
 
-            // Set component instances.
-            {
-                FRotator RotationOffset = HoudiniAssetInstanceInputField->GetRotationOffset( VariationIdx );
-                FVector ScaleOffset = HoudiniAssetInstanceInputField->GetScaleOffset( VariationIdx );
+            FRotator RotationOffset = HoudiniAssetInstanceInputField->GetRotationOffset( VariationIdx );
+            FVector ScaleOffset = HoudiniAssetInstanceInputField->GetScaleOffset( VariationIdx );
 
-                const TArray< FTransform > & InstancedTransforms =
-                    HoudiniAssetInstanceInputField->GetInstancedTransforms( VariationIdx );
+            const TArray< FTransform > & InstancedTransforms =
+                HoudiniAssetInstanceInputField->GetInstancedTransforms( VariationIdx );
 
+            // Set component instances, foliage instancers keep their component empty.
+            if ( !IsFoliageInstancer() )
+            {
                 FHoudiniEngineUtils::UpdateInstancedStaticMeshComponentInstances(
                     DuplicatedComponent, InstancedTransforms, RotationOffset, ScaleOffset );
             }
@@ -1178,6 +1235,19 @@ UHoudiniAssetInstanceInput::CloneComponentsAndAttachToActor( AActor * Actor )
             DuplicatedComponent->RegisterComponent();
             DuplicatedComponent->GetBodyInstance()->bAutoWeld = false;
 
+            // The foliage of the Houdini component is removed along with it, so the baked component
+            // gets foliage instances of its own, based on it and placed in its level.
+            if ( IsFoliageInstancer() )
+            {
+                FHoudiniEngineUtils::UpdateFoliageInstances(
+                    DuplicatedComponent, OutStaticMesh, HoudiniAssetComponent->GeneratedFoliageDefaultSettings,
+                    InstancedTransforms, RotationOffset, ScaleOffset );
+            }
+
+            // Baked hierarchical components need their cluster tree, build it now.
+            if ( UHierarchicalInstancedStaticMeshComponent * HISMC = Cast< UHierarchicalInstancedStaticMeshComponent >( DuplicatedComponent ) )
+                HISMC->BuildTreeIfOutdated( false, false );
+
         }
         
     }
@@ -1187,16 +1257,35 @@ UHoudiniAssetInstanceInput::CloneComponentsAndAttachToActor( AActor * Actor )
 
 void
 UHoudiniAssetInstanceInput::GetPathInstaceTransforms(
-    const FString & ObjectInstancePath,
-    const TArray< FString > & PointInstanceValues, const TArray< FTransform > & Transforms,
-    TArray< FTransform > & OutTransforms)
+    int32 PathCount, const TArray< int32 > & PointPathIndices,
+    const TArray< FTransform > & Transforms, const TArray< int32 > & InstanceIds,
+    TArray< TArray< FTransform > > & OutPathTransforms, TArray< TArray< int32 > > & OutPathInstanceIds )
 {
-    OutTransforms.Empty();
+    OutPathTransforms.Empty( PathCount );
+    OutPathTransforms.SetNum( PathCount );
+    OutPathInstanceIds.Empty( PathCount );
+    OutPathInstanceIds.SetNum( PathCount );
+
+    // Count points of each path first, so that each path gets a single contiguous allocation.
+    TArray< int32 > PathPointCounts;
+    PathPointCounts.SetNumZeroed( PathCount );
+    for ( int32 PathIdx : PointPathIndices )
+        PathPointCounts[ PathIdx ]++;
+
+    bool bHasInstanceIds = InstanceIds.Num() == Transforms.Num();
+    for ( int32 PathIdx = 0; PathIdx < PathCount; ++PathIdx )
+    {
+        OutPathTransforms[ PathIdx ].Reserve( PathPointCounts[ PathIdx ] );
+        if ( bHasInstanceIds )
+            OutPathInstanceIds[ PathIdx ].Reserve( PathPointCounts[ PathIdx ] );
+    }
 
-    for ( int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx )
+    for ( int32 Idx = 0; Idx < PointPathIndices.Num(); ++Idx )
     {
-        if ( ObjectInstancePath.Equals( PointInstanceValues[ Idx ] ) )
-            OutTransforms.Add( Transforms[ Idx ] );
+        const int32 PathIdx = PointPathIndices[ Idx ];
+        OutPathTransforms[ PathIdx ].Add( Transforms[ Idx ] );
+        if ( bHasInstanceIds )
+            OutPathInstanceIds[ PathIdx ].Add( InstanceIds[ Idx ] );
     }
 }
 
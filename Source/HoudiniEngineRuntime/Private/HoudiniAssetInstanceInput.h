@@ -134,19 +134,30 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInput : public UHoudiniAsset
         /** Return true if this is an attribute instancer with overrides. **/
         bool IsAttributeInstancerOverride() const;
 
+        /** Return true if this instancer uses hierarchical instanced static mesh components. **/
+        bool IsHierarchicalInstancer() const;
+
+        /** Return true if this instancer writes its instances into the level's foliage. **/
+        bool IsFoliageInstancer() const;
+
 #if WITH_EDITOR
 
         /** Clone all used instance static mesh components and and attach them to provided actor. **/
         void CloneComponentsAndAttachToActor( AActor * Actor );
 
+        /** Remove the foliage instances written by all fields of this instancer. **/
+        void ClearFoliageInstances();
+
 #endif
 
     protected:
 
-        /** Retrieve all transforms for a given path. Used by attribute instancer. **/
+        /** Bucket transforms and instance ids of all points by the index of their instance path, in a single pass. **/
+        /** Used by attribute instancer.                                                                            **/
         void GetPathInstaceTransforms(
-            const FString & ObjectInstancePath, const TArray< FString > & PointInstanceValues,
-            const TArray< FTransform > & Transforms, TArray< FTransform > & OutTransforms );
+            int32 PathCount, const TArray< int32 > & PointPathIndices,
+            const TArray< FTransform > & Transforms, const TArray< int32 > & InstanceIds,
+            TArray< TArray< FTransform > > & OutPathTransforms, TArray< TArray< int32 > > & OutPathInstanceIds );
 
     protected:
 
@@ -158,12 +169,14 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInput : public UHoudiniAsset
         void CreateInstanceInputField(
             const FHoudiniGeoPartObject & HoudiniGeoPartObject,
             const TArray< FTransform > & ObjectTransforms,
+            const TArray< int32 > & ObjectInstanceIds,
             const TArray< UHoudiniAssetInstanceInputField * > & OldInstanceInputFields,
             TArray< UHoudiniAssetInstanceInputField * > & NewInstanceInputFields );
 
         /** Locate or create (if it does not exist) an input field. This version is used with override attribute. **/
         void CreateInstanceInputField(
             UObject * InstancedObject, const TArray< FTransform > & ObjectTransforms,
+            const TArray< int32 > & ObjectInstanceIds,
             const TArray< UHoudiniAssetInstanceInputField * > & OldInstanceInputFields,
             TArray< UHoudiniAssetInstanceInputField * > & NewInstanceInputFields );
 
@@ -295,6 +308,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInput : public UHoudiniAsset
 
                 /** Set to true if this is a packed primitive instancer **/
                 uint32 bIsPackedPrimitiveInstancer : 1;
+
+                /** Set to true if this instancer uses hierarchical instanced static mesh components. **/
+                uint32 bIsHierarchicalInstancer : 1;
+
+                /** Set to true if this instancer writes its instances into the level's foliage. **/
+                uint32 bIsFoliageInstancer : 1;
             };
 
             uint32 HoudiniAssetInstanceInputFlagsPacked;
@@ -208,10 +208,15 @@ UHoudiniAssetInstanceInputField::AddInstanceComponent( int32 VariationIdx )
 
     if ( UStaticMesh * StaticMesh = Cast<UStaticMesh>( InstancedObjects[ VariationIdx ] ) )
     {
+        // Hierarchical components cull and LOD instances per cluster, their cluster tree is built asynchronously.
+        UClass * InstancedStaticMeshComponentClass = UInstancedStaticMeshComponent::StaticClass();
+        if ( HoudiniAssetInstanceInput && HoudiniAssetInstanceInput->IsHierarchicalInstancer() )
+            InstancedStaticMeshComponentClass = UHierarchicalInstancedStaticMeshComponent::StaticClass();
+
         UInstancedStaticMeshComponent * InstancedStaticMeshComponent =
             NewObject< UInstancedStaticMeshComponent >(
                 HoudiniAssetComponent->GetOwner(),
-                UInstancedStaticMeshComponent::StaticClass(),
+                InstancedStaticMeshComponentClass,
                 NAME_None, RF_Transactional );
 
         InstancerComponents.Insert( InstancedStaticMeshComponent, VariationIdx );
@@ -275,9 +280,25 @@ UHoudiniAssetInstanceInputField::AddInstanceComponent( int32 VariationIdx )
 }
 
 void
-UHoudiniAssetInstanceInputField::SetInstanceTransforms( const TArray< FTransform > & ObjectTransforms )
+UHoudiniAssetInstanceInputField::SetInstanceTransforms(
+    const TArray< FTransform > & ObjectTransforms, const TArray< int32 > & ObjectInstanceIds )
 {
     InstancedTransforms = ObjectTransforms;
+
+    if ( ObjectInstanceIds.Num() == ObjectTransforms.Num() )
+        InstancedIds = ObjectInstanceIds;
+    else
+        InstancedIds.Empty();
+
+    // Static mesh components need to be recreated if the instancer switched to or from hierarchical instancing.
+    bool bIsHierarchicalInstancer = HoudiniAssetInstanceInput && HoudiniAssetInstanceInput->IsHierarchicalInstancer();
+    for ( int32 Idx = 0; Idx < InstancerComponents.Num(); ++Idx )
+    {
+        UInstancedStaticMeshComponent * ISMC = Cast< UInstancedStaticMeshComponent >( InstancerComponents[ Idx ] );
+        if ( ISMC && ISMC->IsA< UHierarchicalInstancedStaticMeshComponent >() != bIsHierarchicalInstancer )
+            RecreateInstanceComponent( Idx );
+    }
+
     UpdateInstanceTransforms( true );
 }
 
@@ -297,26 +318,70 @@ UHoudiniAssetInstanceInputField::UpdateInstanceTransforms( bool RecomputeVariati
         }
 
         VariationTransformsArray.Empty();
+        VariationInstanceIdsArray.Empty();
 
         for ( int32 Idx = 0; Idx < VariationCount; Idx++ )
         {
             TArray< FTransform > VariationTransforms;
             VariationTransformsArray.Add( VariationTransforms );
+            VariationInstanceIdsArray.Add( TArray< int32 >() );
         }
 
+        bool bHasInstanceIds = InstancedIds.Num() == NumInstancTransforms;
         for ( int32 Idx = 0; Idx < NumInstancTransforms; Idx++ )
         {
             FTransform Xform = InstancedTransforms[ Idx ];
-            int32 VariationIndex = fastrand(nSeed) % VariationCount;
+
+            // With stable ids, an instance keeps its variation across cooks.
+            int32 VariationIndex = 0;
+            if ( bHasInstanceIds )
+            {
+                VariationIndex = GetTypeHash( InstancedIds[ Idx ] ) % VariationCount;
+                VariationInstanceIdsArray[ VariationIndex ].Add( InstancedIds[ Idx ] );
+            }
+            else
+            {
+                VariationIndex = fastrand(nSeed) % VariationCount;
+            }
+
             VariationTransformsArray[ VariationIndex ].Add( Xform );
         }
     }
 
+    InstancerComponentInstanceIds.SetNum( VariationCount );
+
+    bool bIsFoliageInstancer = HoudiniAssetInstanceInput && HoudiniAssetInstanceInput->IsFoliageInstancer();
+
     for ( int32 Idx = 0; Idx < VariationCount; Idx++ )
     {
+#if WITH_EDITOR
+        // Foliage instances use the variation component as their base, which keeps track of the ones we own.
+        if ( UInstancedStaticMeshComponent * ISMC = Cast< UInstancedStaticMeshComponent >( InstancerComponents[ Idx ] ) )
+        {
+            if ( bIsFoliageInstancer )
+            {
+                FHoudiniEngineUtils::UpdateFoliageInstances(
+                    ISMC, ISMC->GetStaticMesh(),
+                    HoudiniAssetComponent ? HoudiniAssetComponent->GeneratedFoliageDefaultSettings : nullptr,
+                    VariationTransformsArray[ Idx ], RotationOffsets[ Idx ], ScaleOffsets[ Idx ] );
+
+                // The component itself stays empty.
+                FHoudiniEngineUtils::UpdateInstancedStaticMeshComponentInstances(
+                    ISMC, TArray< FTransform >(), TArray< int32 >(), InstancerComponentInstanceIds[ Idx ],
+                    RotationOffsets[ Idx ], ScaleOffsets[ Idx ] );
+                continue;
+            }
+
+            FHoudiniEngineUtils::ClearFoliageInstances( ISMC );
+        }
+#endif
+
+        // Component ids that got out of sync with their component are detected and the component is refilled.
         FHoudiniEngineUtils::UpdateInstancedStaticMeshComponentInstances(
             InstancerComponents[ Idx ],
             VariationTransformsArray[ Idx ],
+            VariationInstanceIdsArray.IsValidIndex( Idx ) ? VariationInstanceIdsArray[ Idx ] : TArray< int32 >(),
+            InstancerComponentInstanceIds[ Idx ],
             RotationOffsets[ Idx ],
             ScaleOffsets[ Idx ] );
     }
@@ -390,6 +455,9 @@ UHoudiniAssetInstanceInputField::RemoveInstanceVariation( int32 VariationIdx )
     // Remove instanced component.
     if ( USceneComponent* Comp = InstancerComponents[ VariationIdx ] )
     {
+#if WITH_EDITOR
+        FHoudiniEngineUtils::ClearFoliageInstances( Comp );
+#endif
         Comp->DestroyComponent();
     }
     InstancerComponents.RemoveAt( VariationIdx );
@@ -435,16 +503,25 @@ UHoudiniAssetInstanceInputField::ReplaceInstanceVariation( UObject * InObject, i
     if ( bComponentNeedToBeCreated )
     {
         // We'll create a new InstanceComponent
-        FTransform SavedXform = InstancerComponents[ Index ]->GetRelativeTransform();
-        InstancerComponents[ Index ]->DestroyComponent();
-        InstancerComponents.RemoveAt( Index );
-        AddInstanceComponent( Index );
-        InstancerComponents[ Index ]->SetRelativeTransform( SavedXform );
+        RecreateInstanceComponent( Index );
     }
 
     UpdateInstanceTransforms( false );
 }
 
+void
+UHoudiniAssetInstanceInputField::RecreateInstanceComponent( int32 VariationIdx )
+{
+    FTransform SavedXform = InstancerComponents[ VariationIdx ]->GetRelativeTransform();
+#if WITH_EDITOR
+    FHoudiniEngineUtils::ClearFoliageInstances( InstancerComponents[ VariationIdx ] );
+#endif
+    InstancerComponents[ VariationIdx ]->DestroyComponent();
+    InstancerComponents.RemoveAt( VariationIdx );
+    AddInstanceComponent( VariationIdx );
+    InstancerComponents[ VariationIdx ]->SetRelativeTransform( SavedXform );
+}
+
 void
 UHoudiniAssetInstanceInputField::FindObjectIndices( UObject * InStaticMesh, TArray< int32 > & Indices )
 {
@@ -487,6 +564,16 @@ UHoudiniAssetInstanceInputField::GetComboButton() const
     return StaticMeshComboButton;
 }
 
+void
+UHoudiniAssetInstanceInputField::ClearFoliageInstances()
+{
+    for ( USceneComponent * Comp : InstancerComponents )
+    {
+        if ( Comp && Comp->IsA< UInstancedStaticMeshComponent >() )
+            FHoudiniEngineUtils::ClearFoliageInstances( Comp );
+    }
+}
+
 #endif
 
 const FRotator &
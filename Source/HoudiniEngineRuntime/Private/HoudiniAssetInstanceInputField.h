@@ -118,6 +118,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInputField : public UObject
 
         /** Get combo button used by static mesh used by this field. **/
         TSharedPtr< SComboButton > GetComboButton() const;
+
+        /** Remove the foliage instances written by the components of this field. **/
+        void ClearFoliageInstances();
 #endif
         /** After duplicating this field we need to fix up the referenced external objects */
         void FixInstancedObjects( const TMap<UObject*, UObject*>& ReplacementMap );
@@ -163,8 +166,11 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInputField : public UObject
         /** Create instanced component for this field. **/
         void AddInstanceComponent( int32 VariationIdx );
 
-        /** Set transforms for this field. **/
-        void SetInstanceTransforms( const TArray< FTransform > & ObjectTransforms );
+        /** Destroy and create again the instanced component of a given variation. **/
+        void RecreateInstanceComponent( int32 VariationIdx );
+
+        /** Set transforms and, if available, stable instance ids for this field. **/
+        void SetInstanceTransforms( const TArray< FTransform > & ObjectTransforms, const TArray< int32 > & ObjectInstanceIds );
 
         /** Update relative transform for this field. **/
         void UpdateRelativeTransform();
@@ -205,6 +211,15 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInputField : public UObject
         /** Assignment of Transforms to each variation **/
         TArray< TArray< FTransform > > VariationTransformsArray;
 
+        /** Stable instance ids, one for each instance. Empty if the instancer does not provide them. **/
+        TArray< int32 > InstancedIds;
+
+        /** Assignment of instance ids to each variation, matching the assigned transforms. **/
+        TArray< TArray< int32 > > VariationInstanceIdsArray;
+
+        /** Ids of the instances currently held by the instancer component of each variation. **/
+        TArray< TArray< int32 > > InstancerComponentInstanceIds;
+
         /** Corresponding geo part object. **/
         FHoudiniGeoPartObject HoudiniGeoPartObject;
 
@@ -407,6 +407,9 @@ FHoudiniEngine::ShutdownModule()
         HoudiniEngineScheduler = nullptr;
     }
 
+    // Shared input assets go away with the session.
+    StaticMeshInputAssets.Empty();
+
     // Perform HAPI finalization.
     if ( FHoudiniApi::IsHAPIInitialized() )
         FHoudiniApi::Cleanup( GetSession() );
@@ -452,3 +455,49 @@ FHoudiniEngine::RetrieveTaskInfo( const FGuid HapIGUID, FHoudiniEngineTaskInfo &
 
     return false;
 }
+
+bool
+FHoudiniEngine::AcquireStaticMeshInputAsset( UStaticMesh * StaticMesh, uint32 ContentHash, HAPI_AssetId & AssetId )
+{
+    for ( TMap< HAPI_AssetId, FHoudiniStaticMeshInputAsset >::TIterator Iter( StaticMeshInputAssets ); Iter; ++Iter )
+    {
+        FHoudiniStaticMeshInputAsset & StaticMeshInputAsset = Iter.Value();
+        if ( StaticMeshInputAsset.StaticMesh.Get() == StaticMesh && StaticMeshInputAsset.ContentHash == ContentHash )
+        {
+            StaticMeshInputAsset.ReferenceCount++;
+            AssetId = Iter.Key();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void
+FHoudiniEngine::AddStaticMeshInputAsset( UStaticMesh * StaticMesh, uint32 ContentHash, HAPI_AssetId AssetId )
+{
+    FHoudiniStaticMeshInputAsset & StaticMeshInputAsset = StaticMeshInputAssets.Add( AssetId );
+    StaticMeshInputAsset.StaticMesh = StaticMesh;
+    StaticMeshInputAsset.ContentHash = ContentHash;
+    StaticMeshInputAsset.ReferenceCount = 1;
+}
+
+bool
+FHoudiniEngine::ReleaseStaticMeshInputAsset( HAPI_AssetId AssetId )
+{
+    FHoudiniStaticMeshInputAsset * StaticMeshInputAsset = StaticMeshInputAssets.Find( AssetId );
+    if ( !StaticMeshInputAsset )
+        return true;
+
+    if ( --StaticMeshInputAsset->ReferenceCount > 0 )
+        return false;
+
+    StaticMeshInputAssets.Remove( AssetId );
+    return true;
+}
+
+void
+FHoudiniEngine::RemoveStaticMeshInputAsset( HAPI_AssetId AssetId )
+{
+    StaticMeshInputAssets.Remove( AssetId );
+}
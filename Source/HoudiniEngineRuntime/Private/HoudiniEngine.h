@@ -37,6 +37,19 @@ class UStaticMesh;
 class FRunnableThread;
 class FHoudiniEngineScheduler;
 
+/** Input asset holding an uploaded static mesh, shared by all inputs using the same mesh content. **/
+struct FHoudiniStaticMeshInputAsset
+{
+    /** Static mesh which was uploaded. **/
+    TWeakObjectPtr< UStaticMesh > StaticMesh;
+
+    /** Hash of the uploaded mesh content. **/
+    uint32 ContentHash;
+
+    /** Number of inputs using this asset. **/
+    int32 ReferenceCount;
+};
+
 class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
 {
     public:
@@ -84,6 +97,20 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         /** Return true if singleton instance has been created. **/
         static bool IsInitialized();
 
+    public:
+
+        /** Look up the shared input asset holding this static mesh content and add a reference to it. **/
+        bool AcquireStaticMeshInputAsset( UStaticMesh * StaticMesh, uint32 ContentHash, HAPI_AssetId & AssetId );
+
+        /** Register a newly uploaded input asset as shared, with a single reference. **/
+        void AddStaticMeshInputAsset( UStaticMesh * StaticMesh, uint32 ContentHash, HAPI_AssetId AssetId );
+
+        /** Release a reference to an input asset. Return true if the asset is no longer used and can be destroyed. **/
+        bool ReleaseStaticMeshInputAsset( HAPI_AssetId AssetId );
+
+        /** Forget a shared input asset, regardless of its references. **/
+        void RemoveStaticMeshInputAsset( HAPI_AssetId AssetId );
+
     private:
 
         /** Singleton instance of Houdini Engine. **/
@@ -113,6 +140,9 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         /** Map of task statuses. **/
         TMap< FGuid, FHoudiniEngineTaskInfo > TaskInfos;
 
+        /** Shared static mesh input assets, by asset id. **/
+        TMap< HAPI_AssetId, FHoudiniStaticMeshInputAsset > StaticMeshInputAssets;
+
         /** Thread used to execute the scheduler. **/
         FRunnableThread * HoudiniEngineSchedulerThread;
 
@@ -115,6 +115,7 @@
 #include "Curves/CurveFloat.h"
 #include "Curves/CurveLinearColor.h"
 #include "Components/InstancedStaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "StaticMeshResources.h"
 
 /** Houdini Engine Runtime Module Localization. **/
@@ -250,12 +251,17 @@ DECLARE_LOG_CATEGORY_EXTERN( LogHoudiniEngine, Log, All );
 #define HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME              "unreal_input_mesh_name"
 #define HAPI_UNREAL_ATTRIB_MESH_SOCKET_NAME             "unreal_mesh_socket_name"
 #define HAPI_UNREAL_ATTRIB_MESH_SOCKET_ACTOR            "unreal_mesh_socket_actor"
+#define HAPI_UNREAL_ATTRIB_LOD                          "unreal_lod"
+#define HAPI_UNREAL_ATTRIB_MERGE_SMALL_PARTS            "unreal_merge_small_parts"
+#define HAPI_UNREAL_ATTRIB_HIERARCHICAL_INSTANCING      "unreal_hierarchical_instancing"
+#define HAPI_UNREAL_ATTRIB_FOLIAGE                      "unreal_foliage"
 
 /** Names of other Houdini Engine attributes and parameters. **/
 #define HAPI_UNREAL_ATTRIB_INSTANCE                     "instance"
 #define HAPI_UNREAL_ATTRIB_INSTANCE_ROTATION            "rot"
 #define HAPI_UNREAL_ATTRIB_INSTANCE_SCALE               "scale"
 #define HAPI_UNREAL_ATTRIB_INSTANCE_POSITION            HAPI_ATTRIB_POSITION
+#define HAPI_UNREAL_ATTRIB_INSTANCE_ID                  "id"
 #define HAPI_UNREAL_ATTRIB_POSITION                     HAPI_ATTRIB_POSITION
 #define HAPI_UNREAL_ATTRIB_ROTATION                     "rot"
 #define HAPI_UNREAL_ATTRIB_SCALE                        "scale"
@@ -394,6 +400,9 @@ DECLARE_LOG_CATEGORY_EXTERN( LogHoudiniEngine, Log, All );
 /** Group name prefix used to mark mesh sockets **/
 #define HAPI_UNREAL_GROUP_MESH_SOCKETS                  "socket"
 
+/** Group name prefix used to mark geometry of a given LOD (lod0, lod1, ...). **/
+#define HAPI_UNREAL_GROUP_LOD_PREFIX                    "lod"
+
 /** Details panel desired sizes. **/
 #define HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH              270
 #define HAPI_UNREAL_DESIRED_ROW_FULL_WIDGET_WIDTH               310
@@ -433,6 +442,22 @@ DECLARE_LOG_CATEGORY_EXTERN( LogHoudiniEngine, Log, All );
 /** Small value used for comparisons. **/
 #define HAPI_UNREAL_SCALE_SMALL_VALUE                       KINDA_SMALL_NUMBER * 2.0f
 
+/** Fraction of changed instances above which instanced components are refilled in one pass instead of updated. **/
+#define HAPI_UNREAL_INSTANCE_INCREMENTAL_UPDATE_RATIO       0.5f
+
+/** Name prefix of the foliage types created for instancer output, these are removed once they have no instances. **/
+#define HAPI_UNREAL_FOLIAGE_TYPE_PREFIX                     TEXT( "HoudiniFoliageType" )
+
+/** Size of the tiles used to upload volumes. **/
+#define HAPI_UNREAL_VOLUME_TILE_SIZE                        8
+
+/** Names of the heightfield volumes created from landscapes. **/
+#define HAPI_UNREAL_HEIGHTFIELD_HEIGHT_NAME                 "height"
+#define HAPI_UNREAL_HEIGHTFIELD_MASK_NAME                   "mask"
+
+/** Number of transforms converted by each task when translating transform arrays. **/
+#define HAPI_UNREAL_PARALLEL_TRANSFORM_CHUNK_SIZE           4096
+
 /** Default material name. **/
 #define HAPI_UNREAL_DEFAULT_MATERIAL_NAME                   TEXT( "default_material" )
 
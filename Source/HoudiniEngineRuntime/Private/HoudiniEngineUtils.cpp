@@ -42,11 +42,24 @@
 #include "Components/SplineComponent.h"
 #include "LandscapeInfo.h"
 #include "LandscapeComponent.h"
+#include "LandscapeEdit.h"
 #include "HoudiniInstancedActorComponent.h"
 
 #include "AI/Navigation/NavCollision.h"
+#include "AI/Navigation/NavigationSystem.h"
+#include "InstancedFoliageActor.h"
+#include "InstancedFoliage.h"
+#include "FoliageType_InstancedStaticMesh.h"
 #include "PhysicsEngine/AggregateGeom.h"
 #include "Engine/StaticMeshSocket.h"
+#include "Async/ParallelFor.h"
+
+/** Scratch container usage of the last static mesh creation, shown with "stat HoudiniEngine". **/
+DECLARE_STATS_GROUP( TEXT( "HoudiniEngine" ), STATGROUP_HoudiniEngine, STATCAT_Advanced );
+DECLARE_MEMORY_STAT( TEXT( "Mesh Scratch Peak Size" ), STAT_HoudiniMeshScratchPeakSize, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT( "Mesh Scratch Splits" ), STAT_HoudiniMeshScratchSplits, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT( "Mesh Scratch Allocations" ), STAT_HoudiniMeshScratchAllocations, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT( "Mesh Scratch Allocations Avoided" ), STAT_HoudiniMeshScratchAllocationsAvoided, STATGROUP_HoudiniEngine );
 
 const FString kResultStringSuccess( TEXT( "Success" ) );
 const FString kResultStringFailure( TEXT( "Generic Failure" ) );
@@ -376,20 +389,28 @@ FHoudiniEngineUtils::GetUniqueMaterialShopName( HAPI_AssetId AssetId, HAPI_Mater
     return false;
 }
 
+inline
 void
-FHoudiniEngineUtils::TranslateHapiTransform( const HAPI_Transform & HapiTransform, FTransform & UnrealTransform )
+HoudiniGetTransformImportSettings( float & TransformScaleFactor, EHoudiniRuntimeSettingsAxisImport & ImportAxis )
 {
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
-    float TransformScaleFactor = HAPI_UNREAL_SCALE_FACTOR_TRANSLATION;
-    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
+    TransformScaleFactor = HAPI_UNREAL_SCALE_FACTOR_TRANSLATION;
+    ImportAxis = HRSAI_Unreal;
 
     if ( HoudiniRuntimeSettings )
     {
         TransformScaleFactor = HoudiniRuntimeSettings->TransformScaleFactor;
         ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
+}
 
+inline
+void
+HoudiniTranslateHapiTransform(
+    const HAPI_Transform & HapiTransform, float TransformScaleFactor,
+    EHoudiniRuntimeSettingsAxisImport ImportAxis, FTransform & UnrealTransform )
+{
     if ( ImportAxis == HRSAI_Unreal )
     {
         FQuat ObjectRotation(
@@ -427,6 +448,44 @@ FHoudiniEngineUtils::TranslateHapiTransform( const HAPI_Transform & HapiTransfor
     }
 }
 
+void
+FHoudiniEngineUtils::TranslateHapiTransform( const HAPI_Transform & HapiTransform, FTransform & UnrealTransform )
+{
+    float TransformScaleFactor;
+    EHoudiniRuntimeSettingsAxisImport ImportAxis;
+    HoudiniGetTransformImportSettings( TransformScaleFactor, ImportAxis );
+
+    HoudiniTranslateHapiTransform( HapiTransform, TransformScaleFactor, ImportAxis, UnrealTransform );
+}
+
+void
+FHoudiniEngineUtils::TranslateHapiTransforms(
+    const TArray< HAPI_Transform > & HapiTransforms, TArray< FTransform > & UnrealTransforms )
+{
+    QUICK_SCOPE_CYCLE_COUNTER( STAT_HoudiniEngineUtils_TranslateHapiTransforms );
+
+    // Settings are fetched once for the whole batch instead of once per transform.
+    float TransformScaleFactor;
+    EHoudiniRuntimeSettingsAxisImport ImportAxis;
+    HoudiniGetTransformImportSettings( TransformScaleFactor, ImportAxis );
+
+    const int32 TransformCount = HapiTransforms.Num();
+    UnrealTransforms.SetNumUninitialized( TransformCount );
+
+    // Transforms are independent, larger batches are split in chunks converted on worker threads.
+    const int32 ChunkSize = HAPI_UNREAL_PARALLEL_TRANSFORM_CHUNK_SIZE;
+    const int32 ChunkCount = ( TransformCount + ChunkSize - 1 ) / ChunkSize;
+
+    ParallelFor( ChunkCount, [ & ]( int32 ChunkIdx )
+    {
+        const int32 ChunkStart = ChunkIdx * ChunkSize;
+        const int32 ChunkEnd = FMath::Min( ChunkStart + ChunkSize, TransformCount );
+
+        for ( int32 Idx = ChunkStart; Idx < ChunkEnd; ++Idx )
+            HoudiniTranslateHapiTransform( HapiTransforms[ Idx ], TransformScaleFactor, ImportAxis, UnrealTransforms[ Idx ] );
+    }, ChunkCount < 2 );
+}
+
 void
 FHoudiniEngineUtils::TranslateHapiTransform( const HAPI_TransformEuler & HapiTransformEuler, FTransform & UnrealTransform )
 {
@@ -837,9 +896,15 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
     // Allocate sufficient buffer for data.
     Data.SetNumUninitialized( AttributeInfo.count * AttributeInfo.tupleSize );
 
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeFloatData(
-        FHoudiniEngine::Get().GetSession(), AssetId, ObjectId, GeoId, PartId, Name,
-        &AttributeInfo, &Data[ 0 ], 0, AttributeInfo.count ), false );
+    // Read the data in chunks, so that a single transfer stays within the marshalling budget.
+    int32 ChunkSize = FHoudiniEngineUtils::GetMarshallingChunkElementCount( AttributeInfo.tupleSize * sizeof( float ) );
+    for ( int32 ChunkStart = 0; ChunkStart < AttributeInfo.count; ChunkStart += ChunkSize )
+    {
+        int32 ChunkLength = FMath::Min( ChunkSize, AttributeInfo.count - ChunkStart );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), AssetId, ObjectId, GeoId, PartId, Name,
+            &AttributeInfo, &Data[ ChunkStart * AttributeInfo.tupleSize ], ChunkStart, ChunkLength ), false );
+    }
 
     // Store the retrieved attribute information.
     ResultAttributeInfo = AttributeInfo;
@@ -889,9 +954,15 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
     // Allocate sufficient buffer for data.
     Data.SetNumUninitialized( AttributeInfo.count * AttributeInfo.tupleSize );
 
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeIntData(
-        FHoudiniEngine::Get().GetSession(), AssetId, ObjectId,
-        GeoId, PartId, Name, &AttributeInfo, &Data[ 0 ], 0, AttributeInfo.count ), false );
+    // Read the data in chunks, so that a single transfer stays within the marshalling budget.
+    int32 ChunkSize = FHoudiniEngineUtils::GetMarshallingChunkElementCount( AttributeInfo.tupleSize * sizeof( int32 ) );
+    for ( int32 ChunkStart = 0; ChunkStart < AttributeInfo.count; ChunkStart += ChunkSize )
+    {
+        int32 ChunkLength = FMath::Min( ChunkSize, AttributeInfo.count - ChunkStart );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeIntData(
+            FHoudiniEngine::Get().GetSession(), AssetId, ObjectId,
+            GeoId, PartId, Name, &AttributeInfo, &Data[ ChunkStart * AttributeInfo.tupleSize ], ChunkStart, ChunkLength ), false );
+    }
 
     // Store the retrieved attribute information.
     ResultAttributeInfo = AttributeInfo;
@@ -910,6 +981,193 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
         ResultAttributeInfo, Data, TupleSize );
 }
 
+/** Locate an attribute on any owner, overriding its tuple size if one is given. **/
+inline bool
+HoudiniGetAttributeInfo(
+    HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId, HAPI_PartId PartId,
+    const char * Name, int32 TupleSize, HAPI_AttributeInfo & AttributeInfo )
+{
+    for ( int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx )
+    {
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
+            FHoudiniEngine::Get().GetSession(), AssetId, ObjectId, GeoId, PartId, Name,
+            (HAPI_AttributeOwner) AttrIdx, &AttributeInfo ), false );
+
+        if ( AttributeInfo.exists )
+            break;
+    }
+
+    if ( !AttributeInfo.exists )
+        return false;
+
+    if ( TupleSize > 0 )
+        AttributeInfo.tupleSize = TupleSize;
+
+    return true;
+}
+
+/** Read an attribute chunk by chunk and scatter it to the valid entries of a vertex list, every Stride entries. **/
+/** A stride of one gives per wedge data, a stride of three per face data.                                       **/
+template< typename DataType, typename ChunkReaderType >
+inline bool
+HoudiniScatterAttributeChunks(
+    const TArray< int32 > & VertexList, int32 Stride, const HAPI_AttributeInfo & AttributeInfo,
+    ChunkReaderType ChunkReader, TArray< DataType > & Data )
+{
+    const int32 TupleSize = AttributeInfo.tupleSize;
+
+    int32 ValidCount = 0;
+    for ( int32 WedgeIdx = 0; WedgeIdx < VertexList.Num(); WedgeIdx += Stride )
+    {
+        if ( VertexList[ WedgeIdx ] != -1 )
+            ValidCount++;
+    }
+
+    Data.SetNumZeroed( ValidCount * TupleSize );
+    if ( TupleSize <= 0 || AttributeInfo.count <= 0 )
+        return true;
+
+    // Chunks are staged on the thread's mem stack, which is released when we return.
+    FMemMark MemMark( FMemStack::Get() );
+
+    const int32 ChunkSize = FMath::Min(
+        FHoudiniEngineUtils::GetMarshallingChunkElementCount( TupleSize * sizeof( DataType ) ), AttributeInfo.count );
+    TArray< DataType, TMemStackAllocator<> > ChunkData;
+    ChunkData.SetNumUninitialized( ChunkSize * TupleSize );
+
+    for ( int32 ChunkStart = 0; ChunkStart < AttributeInfo.count; ChunkStart += ChunkSize )
+    {
+        const int32 ChunkLength = FMath::Min( ChunkSize, AttributeInfo.count - ChunkStart );
+        if ( !ChunkReader( ChunkData.GetData(), ChunkStart, ChunkLength ) )
+            return false;
+
+        int32 ValidIdx = 0;
+        for ( int32 WedgeIdx = 0; WedgeIdx < VertexList.Num(); WedgeIdx += Stride )
+        {
+            const int32 VertexId = VertexList[ WedgeIdx ];
+            if ( VertexId == -1 )
+            {
+                // This is an index/wedge we are skipping due to split.
+                continue;
+            }
+
+            int32 ElementIdx = -1;
+            switch ( AttributeInfo.owner )
+            {
+                case HAPI_ATTROWNER_POINT:
+                {
+                    ElementIdx = VertexId;
+                    break;
+                }
+
+                case HAPI_ATTROWNER_PRIM:
+                {
+                    ElementIdx = WedgeIdx / 3;
+                    break;
+                }
+
+                case HAPI_ATTROWNER_DETAIL:
+                {
+                    ElementIdx = 0;
+                    break;
+                }
+
+                case HAPI_ATTROWNER_VERTEX:
+                {
+                    ElementIdx = WedgeIdx;
+                    break;
+                }
+
+                default:
+                {
+                    break;
+                }
+            }
+
+            ElementIdx -= ChunkStart;
+            if ( ElementIdx >= 0 && ElementIdx < ChunkLength )
+            {
+                FMemory::Memcpy(
+                    &Data[ ValidIdx * TupleSize ], &ChunkData[ ElementIdx * TupleSize ], TupleSize * sizeof( DataType ) );
+            }
+
+            ValidIdx++;
+        }
+    }
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetVertexAttributeDataAsFloat(
+    HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId, HAPI_PartId PartId, const char * Name,
+    const TArray< int32 > & VertexList, HAPI_AttributeInfo & ResultAttributeInfo, TArray< float > & Data,
+    int32 TupleSize )
+{
+    ResultAttributeInfo.exists = false;
+
+    // Reset container size.
+    Data.SetNumUninitialized( 0 );
+
+    HAPI_AttributeInfo AttributeInfo;
+    if ( !HoudiniGetAttributeInfo( AssetId, ObjectId, GeoId, PartId, Name, TupleSize, AttributeInfo ) )
+        return false;
+
+    auto ChunkReader = [ & ]( float * ChunkData, int32 ChunkStart, int32 ChunkLength )
+    {
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), AssetId, ObjectId, GeoId, PartId, Name,
+            &AttributeInfo, ChunkData, ChunkStart, ChunkLength ), false );
+
+        return true;
+    };
+
+    if ( !HoudiniScatterAttributeChunks( VertexList, 1, AttributeInfo, ChunkReader, Data ) )
+    {
+        Data.SetNumUninitialized( 0 );
+        return false;
+    }
+
+    // Store the retrieved attribute information.
+    ResultAttributeInfo = AttributeInfo;
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetFaceAttributeDataAsInteger(
+    HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId, HAPI_PartId PartId, const char * Name,
+    const TArray< int32 > & VertexList, HAPI_AttributeInfo & ResultAttributeInfo, TArray< int32 > & Data,
+    int32 TupleSize )
+{
+    ResultAttributeInfo.exists = false;
+
+    // Reset container size.
+    Data.SetNumUninitialized( 0 );
+
+    HAPI_AttributeInfo AttributeInfo;
+    if ( !HoudiniGetAttributeInfo( AssetId, ObjectId, GeoId, PartId, Name, TupleSize, AttributeInfo ) )
+        return false;
+
+    auto ChunkReader = [ & ]( int32 * ChunkData, int32 ChunkStart, int32 ChunkLength )
+    {
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeIntData(
+            FHoudiniEngine::Get().GetSession(), AssetId, ObjectId, GeoId, PartId, Name,
+            &AttributeInfo, ChunkData, ChunkStart, ChunkLength ), false );
+
+        return true;
+    };
+
+    if ( !HoudiniScatterAttributeChunks( VertexList, 3, AttributeInfo, ChunkReader, Data ) )
+    {
+        Data.SetNumUninitialized( 0 );
+        return false;
+    }
+
+    // Store the retrieved attribute information.
+    ResultAttributeInfo = AttributeInfo;
+    return true;
+}
+
 bool
 FHoudiniEngineUtils::HapiGetAttributeDataAsString(
     HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId,
@@ -919,7 +1177,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
     ResultAttributeInfo.exists = false;
 
     // Reset container size.
-    Data.Empty();
+    Data.Reset();
 
     int32 OriginalTupleSize = TupleSize;
     HAPI_AttributeInfo AttributeInfo;
@@ -940,11 +1198,11 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
         AttributeInfo.tupleSize = OriginalTupleSize;
 
     TArray< HAPI_StringHandle > StringHandles;
-    StringHandles.Init( -1, AttributeInfo.count * AttributeInfo.tupleSize );
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeStringData(
-        FHoudiniEngine::Get().GetSession(), AssetId,
-        ObjectId, GeoId, PartId, Name, &AttributeInfo,
-        &StringHandles[ 0 ], 0, AttributeInfo.count ), false );
+    if ( !FHoudiniEngineUtils::HapiGetAttributeStringHandles(
+        AssetId, ObjectId, GeoId, PartId, Name, AttributeInfo, StringHandles ) )
+    {
+        return false;
+    }
 
     for ( int32 Idx = 0; Idx < StringHandles.Num(); ++Idx )
     {
@@ -972,6 +1230,102 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
         ResultAttributeInfo, Data, TupleSize );
 }
 
+bool
+FHoudiniEngineUtils::HapiGetPointPositions(
+    HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId, HAPI_PartId PartId,
+    float ScaleFactor, bool bSwapYZ, TArray< FVector > & Positions )
+{
+    Positions.SetNumUninitialized( 0 );
+
+    HAPI_AttributeInfo AttributeInfo;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
+        FHoudiniEngine::Get().GetSession(), AssetId, ObjectId, GeoId, PartId, HAPI_UNREAL_ATTRIB_POSITION,
+        HAPI_ATTROWNER_POINT, &AttributeInfo ), false );
+
+    if ( !AttributeInfo.exists )
+        return false;
+
+    // FVector is laid out as three floats, so HAPI can write into it directly.
+    AttributeInfo.tupleSize = 3;
+    Positions.SetNumUninitialized( AttributeInfo.count );
+
+    int32 ChunkSize = FHoudiniEngineUtils::GetMarshallingChunkElementCount( sizeof( FVector ) );
+    for ( int32 ChunkStart = 0; ChunkStart < AttributeInfo.count; ChunkStart += ChunkSize )
+    {
+        int32 ChunkLength = FMath::Min( ChunkSize, AttributeInfo.count - ChunkStart );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), AssetId, ObjectId, GeoId, PartId, HAPI_UNREAL_ATTRIB_POSITION,
+            &AttributeInfo, &Positions[ ChunkStart ].X, ChunkStart, ChunkLength ), false );
+
+        // Convert this chunk while it is still hot in cache.
+        for ( int32 PositionIdx = ChunkStart; PositionIdx < ChunkStart + ChunkLength; ++PositionIdx )
+        {
+            FVector & Position = Positions[ PositionIdx ];
+            if ( bSwapYZ )
+                Swap( Position.Y, Position.Z );
+
+            Position *= ScaleFactor;
+        }
+    }
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetVertexList(
+    HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId, HAPI_PartId PartId,
+    int32 VertexCount, TArray< int32 > & VertexList )
+{
+    VertexList.SetNumUninitialized( VertexCount );
+
+    int32 ChunkSize = FHoudiniEngineUtils::GetMarshallingChunkElementCount( sizeof( int32 ) );
+    for ( int32 ChunkStart = 0; ChunkStart < VertexCount; ChunkStart += ChunkSize )
+    {
+        int32 ChunkLength = FMath::Min( ChunkSize, VertexCount - ChunkStart );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetVertexList(
+            FHoudiniEngine::Get().GetSession(), AssetId, ObjectId, GeoId, PartId,
+            &VertexList[ ChunkStart ], ChunkStart, ChunkLength ), false );
+    }
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetAttributeStringHandles(
+    HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId, HAPI_PartId PartId,
+    const char * Name, const HAPI_AttributeInfo & AttributeInfo, TArray< HAPI_StringHandle > & StringHandles )
+{
+    StringHandles.Init( -1, AttributeInfo.count * AttributeInfo.tupleSize );
+
+    HAPI_AttributeInfo ChunkAttributeInfo = AttributeInfo;
+    int32 ChunkSize = FHoudiniEngineUtils::GetMarshallingChunkElementCount( AttributeInfo.tupleSize * sizeof( HAPI_StringHandle ) );
+    for ( int32 ChunkStart = 0; ChunkStart < AttributeInfo.count; ChunkStart += ChunkSize )
+    {
+        int32 ChunkLength = FMath::Min( ChunkSize, AttributeInfo.count - ChunkStart );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeStringData(
+            FHoudiniEngine::Get().GetSession(), AssetId, ObjectId, GeoId, PartId, Name, &ChunkAttributeInfo,
+            &StringHandles[ ChunkStart * AttributeInfo.tupleSize ], ChunkStart, ChunkLength ), false );
+    }
+
+    return true;
+}
+
+int32
+FHoudiniEngineUtils::GetMarshallingChunkElementCount( int32 ElementSize )
+{
+    int32 ChunkSizeMB = 0;
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+        ChunkSizeMB = HoudiniRuntimeSettings->MarshallingChunkSizeMB;
+
+    // No budget, everything is read in one go.
+    if ( ChunkSizeMB <= 0 || ElementSize <= 0 )
+        return MAX_int32;
+
+    int64 ChunkElementCount = ( (int64) ChunkSizeMB * 1024 * 1024 ) / ElementSize;
+    return (int32) FMath::Clamp< int64 >( ChunkElementCount, 1, MAX_int32 );
+}
+
 bool
 FHoudiniEngineUtils::HapiGetInstanceTransforms(
     HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId,
@@ -1252,57 +1606,200 @@ FHoudiniEngineUtils::ResetRawMesh( FRawMesh & RawMesh )
         RawMesh.WedgeTexCoords[ Idx ].Reset();
 }
 
-#endif
-
-bool
-FHoudiniEngineUtils::HapiGetParameterDataAsFloat(
-    HAPI_NodeId NodeId, const std::string ParmName, float DefaultValue, float & OutValue )
+FSHAHash
+FHoudiniEngineUtils::ComputeStaticMeshContentHash(
+    const FRawMesh & RawMesh, const UStaticMesh * StaticMesh, bool bQuantizePositions )
 {
-    float Value = DefaultValue;
-    bool bComputed = false;
+    // Relative positions are quantized, translated copies are not bitwise identical once converted.
+    static const float PositionQuantization = 0.01f;
 
-    HAPI_NodeInfo NodeInfo;
-    FHoudiniApi::GetNodeInfo( FHoudiniEngine::Get().GetSession(), NodeId, &NodeInfo );
+    FSHA1 HashState;
 
-    TArray< HAPI_ParmInfo > NodeParams;
-    NodeParams.SetNumUninitialized( NodeInfo.parmCount );
-    FHoudiniApi::GetParameters(
-        FHoudiniEngine::Get().GetSession(), NodeInfo.id, &NodeParams[ 0 ], 0, NodeInfo.parmCount );
+    const FVector Origin = RawMesh.VertexPositions.Num() > 0 ? RawMesh.VertexPositions[ 0 ] : FVector::ZeroVector;
+    if ( !bQuantizePositions )
+    {
+        HashState.Update(
+            (const uint8 *) RawMesh.VertexPositions.GetData(), RawMesh.VertexPositions.Num() * sizeof( FVector ) );
+    }
 
-    // Get names of parameters.
-    TArray< std::string > NodeParamNames;
-    FHoudiniEngineUtils::HapiRetrieveParameterNames( NodeParams, NodeParamNames );
+    for ( int32 VertexIdx = 0; bQuantizePositions && VertexIdx < RawMesh.VertexPositions.Num(); ++VertexIdx )
+    {
+        const FVector RelativePosition = ( RawMesh.VertexPositions[ VertexIdx ] - Origin ) / PositionQuantization;
+        int32 QuantizedPosition[ 3 ] =
+        {
+            FMath::RoundToInt( RelativePosition.X ),
+            FMath::RoundToInt( RelativePosition.Y ),
+            FMath::RoundToInt( RelativePosition.Z )
+        };
 
-    // See if parameter is present.
-    int32 ParmNameIdx = FHoudiniEngineUtils::HapiFindParameterByName( ParmName, NodeParamNames );
+        HashState.Update( (const uint8 *) QuantizedPosition, sizeof( QuantizedPosition ) );
+    }
 
-    if ( ParmNameIdx != -1 )
+    // Stream sizes, so that the concatenated streams below cannot be ambiguous.
+    int32 StreamSizes[ 7 ] =
     {
-        HAPI_ParmInfo& ParmInfo = NodeParams[ ParmNameIdx ];
-        if ( FHoudiniApi::GetParmFloatValues(
-            FHoudiniEngine::Get().GetSession(), NodeId, &Value,
-            ParmInfo.floatValuesIndex, 1 ) == HAPI_RESULT_SUCCESS )
+        RawMesh.WedgeIndices.Num(), RawMesh.WedgeTangentX.Num(), RawMesh.WedgeTangentY.Num(),
+        RawMesh.WedgeTangentZ.Num(), RawMesh.WedgeColors.Num(), RawMesh.FaceMaterialIndices.Num(),
+        RawMesh.FaceSmoothingMasks.Num()
+    };
+    HashState.Update( (const uint8 *) StreamSizes, sizeof( StreamSizes ) );
+
+    HashState.Update( (const uint8 *) RawMesh.WedgeIndices.GetData(), RawMesh.WedgeIndices.Num() * sizeof( uint32 ) );
+    HashState.Update( (const uint8 *) RawMesh.WedgeTangentX.GetData(), RawMesh.WedgeTangentX.Num() * sizeof( FVector ) );
+    HashState.Update( (const uint8 *) RawMesh.WedgeTangentY.GetData(), RawMesh.WedgeTangentY.Num() * sizeof( FVector ) );
+    HashState.Update( (const uint8 *) RawMesh.WedgeTangentZ.GetData(), RawMesh.WedgeTangentZ.Num() * sizeof( FVector ) );
+    HashState.Update( (const uint8 *) RawMesh.WedgeColors.GetData(), RawMesh.WedgeColors.Num() * sizeof( FColor ) );
+    HashState.Update( (const uint8 *) RawMesh.FaceMaterialIndices.GetData(), RawMesh.FaceMaterialIndices.Num() * sizeof( int32 ) );
+    HashState.Update( (const uint8 *) RawMesh.FaceSmoothingMasks.GetData(), RawMesh.FaceSmoothingMasks.Num() * sizeof( uint32 ) );
+
+    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_MESH_TEXTURE_COORDS; ++TexCoordIdx )
+    {
+        const TArray< FVector2D > & TexCoords = RawMesh.WedgeTexCoords[ TexCoordIdx ];
+        int32 TexCoordCount = TexCoords.Num();
+        HashState.Update( (const uint8 *) &TexCoordCount, sizeof( int32 ) );
+        HashState.Update( (const uint8 *) TexCoords.GetData(), TexCoords.Num() * sizeof( FVector2D ) );
+    }
+
+    if ( StaticMesh )
+    {
+        HashState.Update( (const uint8 *) &StaticMesh->LightMapCoordinateIndex, sizeof( int32 ) );
+
+        for ( int32 MaterialIdx = 0; MaterialIdx < StaticMesh->StaticMaterials.Num(); ++MaterialIdx )
         {
-            bComputed = true;
+            UMaterialInterface * MaterialInterface = StaticMesh->StaticMaterials[ MaterialIdx ].MaterialInterface;
+            FString MaterialPathName = MaterialInterface ? MaterialInterface->GetPathName() : FString();
+            HashState.UpdateWithString( *MaterialPathName, MaterialPathName.Len() );
         }
     }
 
-    OutValue = Value;
-    return bComputed;
+    HashState.Final();
+
+    FSHAHash ContentHash;
+    HashState.GetHash( ContentHash.Hash );
+    return ContentHash;
 }
 
 bool
-FHoudiniEngineUtils::HapiGetParameterDataAsInteger(
-    HAPI_NodeId NodeId, const std::string ParmName, int32 DefaultValue, int32 & OutValue)
+FHoudiniEngineUtils::HaveSameRelativePositions( const TArray< FVector > & Positions, const TArray< FVector > & OtherPositions )
 {
-    int32 Value = DefaultValue;
-    bool bComputed = false;
+    if ( Positions.Num() != OtherPositions.Num() )
+        return false;
 
-    HAPI_NodeInfo NodeInfo;
-    FHoudiniApi::GetNodeInfo( FHoudiniEngine::Get().GetSession(), NodeId, &NodeInfo );
-    
-    TArray<HAPI_ParmInfo> NodeParams;
-    NodeParams.SetNumUninitialized( NodeInfo.parmCount );
+    if ( Positions.Num() == 0 )
+        return true;
+
+    const FVector & Origin = Positions[ 0 ];
+    const FVector & OtherOrigin = OtherPositions[ 0 ];
+    const float OriginMagnitude = Origin.GetAbsMax() + OtherOrigin.GetAbsMax();
+
+    for ( int32 VertexIdx = 1; VertexIdx < Positions.Num(); ++VertexIdx )
+    {
+        // Translated copies only differ by the rounding of their translation, which grows with the magnitude
+        // of the positions.
+        const float Tolerance =
+            ( OriginMagnitude + Positions[ VertexIdx ].GetAbsMax() + OtherPositions[ VertexIdx ].GetAbsMax() ) * FLT_EPSILON +
+            THRESH_POINTS_ARE_SAME;
+
+        if ( !( Positions[ VertexIdx ] - Origin ).Equals( OtherPositions[ VertexIdx ] - OtherOrigin, Tolerance ) )
+            return false;
+    }
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HaveSameRawMeshStreams( const FRawMesh & RawMesh, const FRawMesh & OtherRawMesh )
+{
+    if ( ( RawMesh.WedgeTangentX.Num() > 0 ) != ( OtherRawMesh.WedgeTangentX.Num() > 0 ) ||
+        ( RawMesh.WedgeTangentY.Num() > 0 ) != ( OtherRawMesh.WedgeTangentY.Num() > 0 ) ||
+        ( RawMesh.WedgeTangentZ.Num() > 0 ) != ( OtherRawMesh.WedgeTangentZ.Num() > 0 ) ||
+        ( RawMesh.WedgeColors.Num() > 0 ) != ( OtherRawMesh.WedgeColors.Num() > 0 ) ||
+        ( RawMesh.FaceSmoothingMasks.Num() > 0 ) != ( OtherRawMesh.FaceSmoothingMasks.Num() > 0 ) )
+    {
+        return false;
+    }
+
+    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_MESH_TEXTURE_COORDS; ++TexCoordIdx )
+    {
+        if ( ( RawMesh.WedgeTexCoords[ TexCoordIdx ].Num() > 0 ) != ( OtherRawMesh.WedgeTexCoords[ TexCoordIdx ].Num() > 0 ) )
+            return false;
+    }
+
+    return true;
+}
+
+void
+FHoudiniEngineUtils::AppendRawMesh( FRawMesh & RawMesh, const FRawMesh & OtherRawMesh )
+{
+    const uint32 VertexOffset = RawMesh.VertexPositions.Num();
+    RawMesh.VertexPositions.Append( OtherRawMesh.VertexPositions );
+
+    RawMesh.WedgeIndices.Reserve( RawMesh.WedgeIndices.Num() + OtherRawMesh.WedgeIndices.Num() );
+    for ( int32 WedgeIdx = 0; WedgeIdx < OtherRawMesh.WedgeIndices.Num(); ++WedgeIdx )
+        RawMesh.WedgeIndices.Add( OtherRawMesh.WedgeIndices[ WedgeIdx ] + VertexOffset );
+
+    RawMesh.WedgeTangentX.Append( OtherRawMesh.WedgeTangentX );
+    RawMesh.WedgeTangentY.Append( OtherRawMesh.WedgeTangentY );
+    RawMesh.WedgeTangentZ.Append( OtherRawMesh.WedgeTangentZ );
+    RawMesh.WedgeColors.Append( OtherRawMesh.WedgeColors );
+    RawMesh.FaceMaterialIndices.Append( OtherRawMesh.FaceMaterialIndices );
+    RawMesh.FaceSmoothingMasks.Append( OtherRawMesh.FaceSmoothingMasks );
+
+    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_MESH_TEXTURE_COORDS; ++TexCoordIdx )
+        RawMesh.WedgeTexCoords[ TexCoordIdx ].Append( OtherRawMesh.WedgeTexCoords[ TexCoordIdx ] );
+}
+
+#endif
+
+bool
+FHoudiniEngineUtils::HapiGetParameterDataAsFloat(
+    HAPI_NodeId NodeId, const std::string ParmName, float DefaultValue, float & OutValue )
+{
+    float Value = DefaultValue;
+    bool bComputed = false;
+
+    HAPI_NodeInfo NodeInfo;
+    FHoudiniApi::GetNodeInfo( FHoudiniEngine::Get().GetSession(), NodeId, &NodeInfo );
+
+    TArray< HAPI_ParmInfo > NodeParams;
+    NodeParams.SetNumUninitialized( NodeInfo.parmCount );
+    FHoudiniApi::GetParameters(
+        FHoudiniEngine::Get().GetSession(), NodeInfo.id, &NodeParams[ 0 ], 0, NodeInfo.parmCount );
+
+    // Get names of parameters.
+    TArray< std::string > NodeParamNames;
+    FHoudiniEngineUtils::HapiRetrieveParameterNames( NodeParams, NodeParamNames );
+
+    // See if parameter is present.
+    int32 ParmNameIdx = FHoudiniEngineUtils::HapiFindParameterByName( ParmName, NodeParamNames );
+
+    if ( ParmNameIdx != -1 )
+    {
+        HAPI_ParmInfo& ParmInfo = NodeParams[ ParmNameIdx ];
+        if ( FHoudiniApi::GetParmFloatValues(
+            FHoudiniEngine::Get().GetSession(), NodeId, &Value,
+            ParmInfo.floatValuesIndex, 1 ) == HAPI_RESULT_SUCCESS )
+        {
+            bComputed = true;
+        }
+    }
+
+    OutValue = Value;
+    return bComputed;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetParameterDataAsInteger(
+    HAPI_NodeId NodeId, const std::string ParmName, int32 DefaultValue, int32 & OutValue)
+{
+    int32 Value = DefaultValue;
+    bool bComputed = false;
+
+    HAPI_NodeInfo NodeInfo;
+    FHoudiniApi::GetNodeInfo( FHoudiniEngine::Get().GetSession(), NodeId, &NodeInfo );
+    
+    TArray<HAPI_ParmInfo> NodeParams;
+    NodeParams.SetNumUninitialized( NodeInfo.parmCount );
     FHoudiniApi::GetParameters(
         FHoudiniEngine::Get().GetSession(), NodeInfo.id, &NodeParams[ 0 ], 0, NodeInfo.parmCount );
 
@@ -2968,153 +3465,688 @@ FHoudiniEngineUtils::HapiCreateAndConnectAsset(
 }
 
 
+#if WITH_EDITOR
+
+/** Landscape area, volume layout and value scaling shared by heightfield export and update. **/
+struct FHoudiniHeightfieldLayout
+{
+    /** Landscape vertex extent covered by the volumes. **/
+    int32 MinX;
+    int32 MinY;
+    int32 MaxX;
+    int32 MaxY;
+
+    /** Volume resolution, one voxel per landscape vertex. **/
+    int32 SizeX;
+    int32 SizeY;
+
+    /** Set when volume rows run opposite to landscape rows. **/
+    bool bFlipRows;
+
+    /** Scale from landscape local heights to Houdini heights. **/
+    float HeightScale;
+
+    /** Transform of the volumes. **/
+    HAPI_Transform VolumeTransform;
+};
+
+inline
 bool
-FHoudiniEngineUtils::HapiCreateAndConnectAsset(
-    HAPI_AssetId HostAssetId,
-    int32 InputIndex,
-    USplineComponent * SplineComponent,
-    HAPI_AssetId & ConnectedAssetId,
-    FHoudiniAssetInputOutlinerMesh& OutlinerMesh,
-    const float& SplineResolution)
+HoudiniGetHeightfieldLayout( ALandscapeProxy * LandscapeProxy, FHoudiniHeightfieldLayout & Layout )
 {
-#if WITH_EDITOR
+    // The heightfield covers all the components of this proxy.
+    Layout.MinX = TNumericLimits< int32 >::Max();
+    Layout.MinY = TNumericLimits< int32 >::Max();
+    Layout.MaxX = TNumericLimits< int32 >::Lowest();
+    Layout.MaxY = TNumericLimits< int32 >::Lowest();
 
-    // If we don't have a spline component, or host asset is invalid, there's nothing to do.
-    if (!SplineComponent || !FHoudiniEngineUtils::IsHoudiniAssetValid(HostAssetId))
+    for ( ULandscapeComponent * LandscapeComponent : LandscapeProxy->LandscapeComponents )
+    {
+        if ( LandscapeComponent )
+            LandscapeComponent->GetComponentExtent( Layout.MinX, Layout.MinY, Layout.MaxX, Layout.MaxY );
+    }
+
+    if ( Layout.MinX > Layout.MaxX || Layout.MinY > Layout.MaxY )
         return false;
 
-    float fSplineResolution = SplineResolution;
-    if (fSplineResolution == -1.0f)
+    Layout.SizeX = Layout.MaxX - Layout.MinX + 1;
+    Layout.SizeY = Layout.MaxY - Layout.MinY + 1;
+
+    // Get runtime settings.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
+    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
+
+    if ( HoudiniRuntimeSettings )
     {
-        // Get runtime settings and extract the spline resolution from it
-        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-        if (HoudiniRuntimeSettings)
-            fSplineResolution = HoudiniRuntimeSettings->MarshallingSplineResolution;
-        else
-            fSplineResolution = HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT;
+        GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
+        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
 
-    int32 nNumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
-    float fSplineLength = SplineComponent->GetSplineLength();
+    // The volume is centered on the covered area, heights are relative to the landscape actor.
+    const FTransform & LandscapeTransform = LandscapeProxy->LandscapeActorToWorld();
+    const FVector LandscapeScale = LandscapeTransform.GetScale3D();
+    const FVector VolumeCenter = LandscapeTransform.TransformPosition( FVector(
+        Layout.MinX + ( Layout.SizeX - 1 ) * 0.5f, Layout.MinY + ( Layout.SizeY - 1 ) * 0.5f, 0.0f ) );
 
-    // Calculate the number of refined point we want
-    int32 nNumberOfRefinedSplinePoints = fSplineResolution > 0.0f ? ceil(fSplineLength / fSplineResolution) + 1 : nNumberOfControlPoints;
+    Layout.HeightScale = LandscapeScale.Z / GeneratedGeometryScaleFactor;
 
-    // Array that will store the attributes we want to add to the curves
-    TArray<FVector> tRefinedSplinePositions;
-    TArray<FQuat> tRefinedSplineRotations;
-    // Scale on Unreal's spline will require some tweaking, as the XScale is always 1
-    TArray<FVector> tRefinedSplineScales;
-    //TArray<float> tRefinedSplinePScales;
+    HAPI_Transform & VolumeTransform = Layout.VolumeTransform;
+    FHoudiniEngineUtils::TranslateUnrealTransform(
+        FTransform( LandscapeTransform.GetRotation(), VolumeCenter ), VolumeTransform );
 
-    if ((nNumberOfRefinedSplinePoints < nNumberOfControlPoints) || (fSplineResolution <= 0.0f))
+    // Volume scales are half extents in voxel axis order.
+    VolumeTransform.scale[ 0 ] = Layout.SizeX * LandscapeScale.X * 0.5f / GeneratedGeometryScaleFactor;
+    VolumeTransform.scale[ 1 ] = Layout.SizeY * LandscapeScale.Y * 0.5f / GeneratedGeometryScaleFactor;
+    VolumeTransform.scale[ 2 ] = LandscapeScale.X * 0.5f / GeneratedGeometryScaleFactor;
+
+    // Houdini heightfields lie in the XY plane of their volume. With Unreal axis import, rotate the volume into
+    // Houdini's XZ ground plane, which maps volume rows to Unreal's -Y, so rows are written in reverse.
+    Layout.bFlipRows = false;
+    if ( ImportAxis == HRSAI_Unreal )
     {
-        // There's not enough refined points, so we'll use the Spline CVs instead
-        tRefinedSplinePositions.SetNumZeroed(nNumberOfControlPoints);
-        tRefinedSplineRotations.SetNumZeroed(nNumberOfControlPoints);
-        tRefinedSplineScales.SetNumZeroed(nNumberOfControlPoints);
-        //tRefinedSplinePScales.SetNumZeroed(nNumberOfControlPoints);
+        FQuat VolumeRotation(
+            VolumeTransform.rotationQuaternion[ 0 ], VolumeTransform.rotationQuaternion[ 1 ],
+            VolumeTransform.rotationQuaternion[ 2 ], VolumeTransform.rotationQuaternion[ 3 ] );
+        VolumeRotation = VolumeRotation * FQuat( FVector( 1.0f, 0.0f, 0.0f ), -HALF_PI );
 
-        FVector Scale;
-        for (int32 n = 0; n < nNumberOfControlPoints; n++)
+        VolumeTransform.rotationQuaternion[ 0 ] = VolumeRotation.X;
+        VolumeTransform.rotationQuaternion[ 1 ] = VolumeRotation.Y;
+        VolumeTransform.rotationQuaternion[ 2 ] = VolumeRotation.Z;
+        VolumeTransform.rotationQuaternion[ 3 ] = VolumeRotation.W;
+
+        Layout.bFlipRows = true;
+    }
+
+    return true;
+}
+
+inline
+void
+HoudiniGetHeightfieldVolumeValues(
+    FLandscapeEditDataInterface & LandscapeEditDataInterface, ULandscapeLayerInfoObject * LayerInfo,
+    const FHoudiniHeightfieldLayout & Layout, const FIntRect & VoxelRect, TArray< float > & Values )
+{
+    // Landscape vertices covered by the voxel rectangle, whose max is exclusive.
+    const int32 RectSizeX = VoxelRect.Width();
+    const int32 RectSizeY = VoxelRect.Height();
+    const int32 X1 = Layout.MinX + VoxelRect.Min.X;
+    const int32 X2 = Layout.MinX + VoxelRect.Max.X - 1;
+    const int32 Y1 = Layout.bFlipRows ? Layout.MaxY - ( VoxelRect.Max.Y - 1 ) : Layout.MinY + VoxelRect.Min.Y;
+    const int32 Y2 = Layout.bFlipRows ? Layout.MaxY - VoxelRect.Min.Y : Layout.MinY + VoxelRect.Max.Y - 1;
+
+    const int32 ValueCount = RectSizeX * RectSizeY;
+    Values.SetNumUninitialized( ValueCount );
+
+    auto GetValueIndex = [ & ]( int32 X, int32 Y )
+    {
+        return ( Layout.bFlipRows ? ( RectSizeY - 1 - Y ) : Y ) * RectSizeX + X;
+    };
+
+    if ( !LayerInfo )
+    {
+        TArray< uint16 > HeightData;
+        HeightData.SetNumZeroed( ValueCount );
+        LandscapeEditDataInterface.GetHeightDataFast( X1, Y1, X2, Y2, HeightData.GetData(), 0 );
+
+        for ( int32 Y = 0; Y < RectSizeY; ++Y )
         {
-            tRefinedSplinePositions[n] = SplineComponent->GetLocationAtSplinePoint(n, ESplineCoordinateSpace::Local);
-            tRefinedSplineRotations[n] = SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World);
-            Scale = SplineComponent->GetScaleAtSplinePoint(n);
-            tRefinedSplineScales[n] = Scale;
-            // tRefinedSplinePScales[n] = (Scale.Y + Scale.Z) / 2.0f; //FMath::Max(Scale.Y, Scale.Z);
+            for ( int32 X = 0; X < RectSizeX; ++X )
+            {
+                const float LocalHeight = LandscapeDataAccess::GetLocalHeight( HeightData[ Y * RectSizeX + X ] );
+                Values[ GetValueIndex( X, Y ) ] = LocalHeight * Layout.HeightScale;
+            }
         }
     }
     else
     {
-        // Calculating the refined spline points
-        tRefinedSplinePositions.SetNumZeroed(nNumberOfRefinedSplinePoints);
-        tRefinedSplineRotations.SetNumZeroed(nNumberOfRefinedSplinePoints);
-        tRefinedSplineScales.SetNumZeroed(nNumberOfRefinedSplinePoints);
-        // tRefinedSplinePScales.SetNumZeroed(nNumberOfRefinedSplinePoints);
+        TArray< uint8 > WeightData;
+        WeightData.SetNumZeroed( ValueCount );
+        LandscapeEditDataInterface.GetWeightDataFast( LayerInfo, X1, Y1, X2, Y2, WeightData.GetData(), 0 );
 
-        FVector Scale;
-        float fCurrentDistance = 0.0f;
-        for (int32 n = 0; n < nNumberOfRefinedSplinePoints; n++)
+        for ( int32 Y = 0; Y < RectSizeY; ++Y )
         {
-            tRefinedSplinePositions[n] = SplineComponent->GetLocationAtDistanceAlongSpline(fCurrentDistance, ESplineCoordinateSpace::Local);
-            tRefinedSplineRotations[n] = SplineComponent->GetQuaternionAtDistanceAlongSpline(fCurrentDistance, ESplineCoordinateSpace::World);
-
-            Scale = SplineComponent->GetScaleAtDistanceAlongSpline(fCurrentDistance);
+            for ( int32 X = 0; X < RectSizeX; ++X )
+                Values[ GetValueIndex( X, Y ) ] = WeightData[ Y * RectSizeX + X ] / 255.0f;
+        }
+    }
+}
 
-            tRefinedSplineScales[n] = Scale;
-            // tRefinedSplinePScales[n] = (Scale.Y + Scale.Z) / 2.0f; //FMath::Max(Scale.Y, Scale.Z);
+inline
+bool
+HoudiniSetHeightfieldVolumeTile(
+    HAPI_AssetId VolumeAssetId, const TArray< float > & Values, const FIntRect & ValuesRect,
+    int32 TileX, int32 TileY, TArray< float > & TileValues )
+{
+    // Only the first slice of each tile is used, the volume is flat.
+    const int32 TileSize = HAPI_UNREAL_VOLUME_TILE_SIZE;
+    TileValues.SetNumUninitialized( TileSize * TileSize * TileSize );
+    FMemory::Memzero( TileValues.GetData(), TileValues.Num() * sizeof( float ) );
 
-            fCurrentDistance += fSplineResolution;
-        }
+    const int32 TileSizeX = FMath::Min( TileSize, ValuesRect.Max.X - TileX );
+    const int32 TileSizeY = FMath::Min( TileSize, ValuesRect.Max.Y - TileY );
+    for ( int32 Y = 0; Y < TileSizeY; ++Y )
+    {
+        const int32 ValueIdx = ( TileY - ValuesRect.Min.Y + Y ) * ValuesRect.Width() + TileX - ValuesRect.Min.X;
+        FMemory::Memcpy( &TileValues[ Y * TileSize ], &Values[ ValueIdx ], TileSizeX * sizeof( float ) );
     }
 
-    if (!HapiCreateCurveAsset(
-            HostAssetId, ConnectedAssetId,
-            &tRefinedSplinePositions,
-            &tRefinedSplineRotations,
-            &tRefinedSplineScales,
-            nullptr) )//&tRefinedSplinePScales) )
-        return false;
+    HAPI_VolumeTileInfo TileInfo;
+    TileInfo.minX = TileX;
+    TileInfo.minY = TileY;
+    TileInfo.minZ = 0;
+    TileInfo.isValid = true;
 
-    // Updating the OutlinerMesh's struct infos
-    OutlinerMesh.SplineResolution = fSplineResolution;
-    OutlinerMesh.SplineLength = fSplineLength;
-    OutlinerMesh.NumberOfSplineControlPoints = nNumberOfControlPoints;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVolumeTileFloatData(
+        FHoudiniEngine::Get().GetSession(), VolumeAssetId, 0, 0, &TileInfo,
+        TileValues.GetData(), TileValues.Num() ), false );
 
-    // We also need to extract all the CV's Transform to check for modifications
-    OutlinerMesh.SplineControlPointsTransform.SetNum(nNumberOfControlPoints);
-    for (int32 n = 0; n < nNumberOfControlPoints; n++)
-    {
-        // Getting the Local Transform for positions and scale
-        OutlinerMesh.SplineControlPointsTransform[n] = SplineComponent->GetTransformAtSplinePoint(n, ESplineCoordinateSpace::Local, true);
+    return true;
+}
 
-        // ... but we used we used the world rotation
-        OutlinerMesh.SplineControlPointsTransform[n].SetRotation(SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World));
-    }
+inline
+bool
+HoudiniFillHeightfieldVolumeAsset(
+    HAPI_AssetId VolumeAssetId, HAPI_AssetId MergeAssetId, int32 MergeInputIdx, const FString & VolumeName,
+    const TArray< float > & Values, const FHoudiniHeightfieldLayout & Layout )
+{
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookAsset(
+        FHoudiniEngine::Get().GetSession(), VolumeAssetId, nullptr ), false );
 
-    // Cook the spline node.
-    HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookAsset(
-        FHoudiniEngine::Get().GetSession(),
-        ConnectedAssetId,
-        nullptr), false);
+    // Create a part holding a single volume primitive.
+    HAPI_PartInfo Part;
+    FMemory::Memzero< HAPI_PartInfo >( Part );
+    Part.id = 0;
+    Part.type = HAPI_PARTTYPE_VOLUME;
+    Part.faceCount = 1;
+    Part.pointCount = 1;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetPartInfo(
+        FHoudiniEngine::Get().GetSession(), VolumeAssetId, 0, 0, &Part ), false );
 
-    // Connect asset.
-    if (!FHoudiniEngineUtils::HapiConnectAsset(ConnectedAssetId, 0, HostAssetId, InputIndex))
+    // Heightfields are flat volumes.
+    HAPI_VolumeInfo VolumeInfo;
+    FMemory::Memzero< HAPI_VolumeInfo >( VolumeInfo );
+    VolumeInfo.type = HAPI_VOLUMETYPE_HOUDINI;
+    VolumeInfo.xLength = Layout.SizeX;
+    VolumeInfo.yLength = Layout.SizeY;
+    VolumeInfo.zLength = 1;
+    VolumeInfo.tupleSize = 1;
+    VolumeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+    VolumeInfo.tileSize = HAPI_UNREAL_VOLUME_TILE_SIZE;
+    VolumeInfo.transform = Layout.VolumeTransform;
+    VolumeInfo.hasTaper = false;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVolumeInfo(
+        FHoudiniEngine::Get().GetSession(), VolumeAssetId, 0, 0, &VolumeInfo ), false );
+
+    // Upload the values tile by tile.
+    const FIntRect VolumeRect( 0, 0, Layout.SizeX, Layout.SizeY );
+    TArray< float > TileValues;
+    for ( int32 TileY = 0; TileY < Layout.SizeY; TileY += HAPI_UNREAL_VOLUME_TILE_SIZE )
     {
-        ConnectedAssetId = -1;
-        return false;
+        for ( int32 TileX = 0; TileX < Layout.SizeX; TileX += HAPI_UNREAL_VOLUME_TILE_SIZE )
+        {
+            if ( !HoudiniSetHeightfieldVolumeTile( VolumeAssetId, Values, VolumeRect, TileX, TileY, TileValues ) )
+                return false;
+        }
     }
 
-#endif
+    // Heightfield layers are identified by the name of their volume.
+    HAPI_AttributeInfo AttributeInfo;
+    FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
+    AttributeInfo.count = 1;
+    AttributeInfo.tupleSize = 1;
+    AttributeInfo.exists = true;
+    AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
+    AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
+    AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
 
-    return true;
-}
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+        FHoudiniEngine::Get().GetSession(), VolumeAssetId, 0, 0, HAPI_ATTRIB_NAME, &AttributeInfo ), false );
+
+    std::string VolumeNameString;
+    FHoudiniEngineUtils::ConvertUnrealString( VolumeName, VolumeNameString );
+    const char * VolumeNameRaw = VolumeNameString.c_str();
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
+        FHoudiniEngine::Get().GetSession(), VolumeAssetId, 0, 0, HAPI_ATTRIB_NAME, &AttributeInfo,
+        &VolumeNameRaw, 0, 1 ), false );
 
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+        FHoudiniEngine::Get().GetSession(), VolumeAssetId, 0, 0 ), false );
 
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectAssetGeometry(
+        FHoudiniEngine::Get().GetSession(), VolumeAssetId, 0, MergeAssetId, MergeInputIdx ), false );
 
+    return true;
+}
 
+inline
 bool
-FHoudiniEngineUtils::HapiCreateAndConnectAsset(
-    HAPI_AssetId HostAssetId, 
-    int32 InputIndex, 
-    UStaticMesh * StaticMesh,
-    HAPI_AssetId & ConnectedAssetId)
+HoudiniCreateHeightfieldVolumeAsset(
+    HAPI_AssetId MergeAssetId, int32 MergeInputIdx, const FString & VolumeName,
+    const TArray< float > & Values, const FHoudiniHeightfieldLayout & Layout, HAPI_AssetId & VolumeAssetId )
 {
-#if WITH_EDITOR
-
-    // If we don't have a static mesh, or host asset is invalid, there's nothing to do.
-    if ( !StaticMesh || !FHoudiniEngineUtils::IsHoudiniAssetValid( HostAssetId ) )
-        return false;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputAsset(
+        FHoudiniEngine::Get().GetSession(), &VolumeAssetId, nullptr ), false );
 
-    // Check if connected asset id is valid, if it is not, we need to create an input asset.
-    if ( ConnectedAssetId < 0 )
+    // A volume which could not be filled is not left behind in the session.
+    if ( !FHoudiniEngineUtils::IsHoudiniAssetValid( VolumeAssetId )
+        || !HoudiniFillHeightfieldVolumeAsset( VolumeAssetId, MergeAssetId, MergeInputIdx, VolumeName, Values, Layout ) )
     {
-        HAPI_AssetId AssetId = -1;
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputAsset(
-            FHoudiniEngine::Get().GetSession(), &AssetId, nullptr ), false );
+        if ( FHoudiniEngineUtils::IsValidAssetId( VolumeAssetId ) )
+            FHoudiniEngineUtils::DestroyHoudiniAsset( VolumeAssetId );
 
-        // Check if we have a valid id for this new input asset.
+        VolumeAssetId = -1;
+        return false;
+    }
+
+    return true;
+}
+
+inline
+void
+HoudiniDestroyHeightfieldAssets( HAPI_AssetId & MergeAssetId, TArray< HAPI_AssetId > & VolumeAssetIds )
+{
+    for ( HAPI_AssetId VolumeAssetId : VolumeAssetIds )
+    {
+        if ( FHoudiniEngineUtils::IsValidAssetId( VolumeAssetId ) )
+            FHoudiniEngineUtils::DestroyHoudiniAsset( VolumeAssetId );
+    }
+
+    VolumeAssetIds.Empty();
+
+    if ( FHoudiniEngineUtils::IsValidAssetId( MergeAssetId ) )
+        FHoudiniEngineUtils::DestroyHoudiniAsset( MergeAssetId );
+
+    MergeAssetId = -1;
+}
+
+#endif
+
+bool
+FHoudiniEngineUtils::HapiCreateAndConnectHeightfieldAsset(
+    HAPI_AssetId HostAssetId, int32 InputIndex, ALandscapeProxy * LandscapeProxy,
+    HAPI_AssetId & ConnectedAssetId, TArray< HAPI_AssetId > & VolumeAssetIds, bool bExportOnlySelected )
+{
+#if WITH_EDITOR
+
+    // If we don't have any landscapes or host asset is invalid then there's nothing to do.
+    if ( !LandscapeProxy || !FHoudiniEngineUtils::IsHoudiniAssetValid( HostAssetId ) )
+        return false;
+
+    ULandscapeInfo * LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+    if ( !LandscapeInfo )
+        return false;
+
+    TSet< ULandscapeComponent * > SelectedComponents;
+    if ( bExportOnlySelected )
+        SelectedComponents = LandscapeInfo->GetSelectedComponents();
+
+    bExportOnlySelected = bExportOnlySelected && SelectedComponents.Num() > 0;
+
+    FHoudiniHeightfieldLayout Layout;
+    if ( !HoudiniGetHeightfieldLayout( LandscapeProxy, Layout ) )
+        return false;
+
+    const FIntRect VolumeRect( 0, 0, Layout.SizeX, Layout.SizeY );
+    FLandscapeEditDataInterface LandscapeEditDataInterface( LandscapeInfo );
+
+    // Volumes are merged into a single input, which becomes our "ConnectedAssetId".
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::InstantiateAsset(
+        FHoudiniEngine::Get().GetSession(), "SOP/merge", true, &ConnectedAssetId ), false );
+
+    int32 MergeInputIdx = 0;
+    HAPI_AssetId VolumeAssetId = -1;
+    TArray< float > Values;
+
+    HoudiniGetHeightfieldVolumeValues( LandscapeEditDataInterface, nullptr, Layout, VolumeRect, Values );
+    if ( !HoudiniCreateHeightfieldVolumeAsset(
+        ConnectedAssetId, MergeInputIdx++, TEXT( HAPI_UNREAL_HEIGHTFIELD_HEIGHT_NAME ), Values, Layout, VolumeAssetId ) )
+    {
+        HoudiniDestroyHeightfieldAssets( ConnectedAssetId, VolumeAssetIds );
+        return false;
+    }
+
+    VolumeAssetIds.Add( VolumeAssetId );
+
+    // Selected components are exported as the heightfield mask.
+    if ( bExportOnlySelected )
+    {
+        Values.SetNumUninitialized( Layout.SizeX * Layout.SizeY );
+        FMemory::Memzero( Values.GetData(), Values.Num() * sizeof( float ) );
+
+        for ( ULandscapeComponent * LandscapeComponent : SelectedComponents )
+        {
+            if ( !LandscapeComponent || LandscapeComponent->GetLandscapeProxy() != LandscapeProxy )
+                continue;
+
+            int32 ComponentMinX = TNumericLimits< int32 >::Max();
+            int32 ComponentMinY = TNumericLimits< int32 >::Max();
+            int32 ComponentMaxX = TNumericLimits< int32 >::Lowest();
+            int32 ComponentMaxY = TNumericLimits< int32 >::Lowest();
+            LandscapeComponent->GetComponentExtent( ComponentMinX, ComponentMinY, ComponentMaxX, ComponentMaxY );
+
+            for ( int32 Y = ComponentMinY; Y <= ComponentMaxY; ++Y )
+            {
+                const int32 VoxelY = Layout.bFlipRows ? Layout.MaxY - Y : Y - Layout.MinY;
+                for ( int32 X = ComponentMinX; X <= ComponentMaxX; ++X )
+                    Values[ VoxelY * Layout.SizeX + X - Layout.MinX ] = 1.0f;
+            }
+        }
+
+        VolumeAssetId = -1;
+        if ( HoudiniCreateHeightfieldVolumeAsset(
+            ConnectedAssetId, MergeInputIdx++, TEXT( HAPI_UNREAL_HEIGHTFIELD_MASK_NAME ), Values, Layout, VolumeAssetId ) )
+        {
+            VolumeAssetIds.Add( VolumeAssetId );
+        }
+    }
+
+    // Paint layers become additional volumes named after the layer.
+    for ( const FLandscapeInfoLayerSettings & LayerSettings : LandscapeInfo->Layers )
+    {
+        if ( !LayerSettings.LayerInfoObj )
+            continue;
+
+        HoudiniGetHeightfieldVolumeValues( LandscapeEditDataInterface, LayerSettings.LayerInfoObj, Layout, VolumeRect, Values );
+
+        VolumeAssetId = -1;
+        if ( HoudiniCreateHeightfieldVolumeAsset(
+            ConnectedAssetId, MergeInputIdx++, LayerSettings.GetLayerName().ToString(), Values, Layout, VolumeAssetId ) )
+        {
+            VolumeAssetIds.Add( VolumeAssetId );
+        }
+    }
+
+    // Now we can connect assets together.
+    HAPI_Result Result = HAPI_RESULT_SUCCESS;
+    HOUDINI_CHECK_ERROR( &Result, FHoudiniApi::ConnectAssetGeometry(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, 0, HostAssetId, InputIndex ) );
+    if ( Result != HAPI_RESULT_SUCCESS )
+    {
+        HoudiniDestroyHeightfieldAssets( ConnectedAssetId, VolumeAssetIds );
+        return false;
+    }
+
+#endif
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiUpdateHeightfieldAsset(
+    ALandscapeProxy * LandscapeProxy, const TArray< HAPI_AssetId > & VolumeAssetIds,
+    const TSet< TWeakObjectPtr< ULandscapeComponent > > & DirtyComponents )
+{
+#if WITH_EDITOR
+
+    if ( !LandscapeProxy || VolumeAssetIds.Num() <= 0 )
+        return false;
+
+    ULandscapeInfo * LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+    if ( !LandscapeInfo )
+        return false;
+
+    FHoudiniHeightfieldLayout Layout;
+    if ( !HoudiniGetHeightfieldLayout( LandscapeProxy, Layout ) )
+        return false;
+
+    // The volumes must still match the landscape: same resolution, and one volume for the height and each layer.
+    TArray< ULandscapeLayerInfoObject * > VolumeLayerInfos;
+    VolumeLayerInfos.Add( nullptr );
+    for ( const FLandscapeInfoLayerSettings & LayerSettings : LandscapeInfo->Layers )
+    {
+        if ( LayerSettings.LayerInfoObj )
+            VolumeLayerInfos.Add( LayerSettings.LayerInfoObj );
+    }
+
+    if ( VolumeLayerInfos.Num() != VolumeAssetIds.Num() )
+        return false;
+
+    // Tiles are written into the geometry committed when the volumes were created: an input asset keeps the
+    // geometry it was given, setter calls edit it in place, and the next commit publishes the whole of it again.
+    // Setting the part or volume info again would rebuild that geometry from scratch, dropping every tile which
+    // is not uploaded here along with the name attribute, so the committed part and volume are checked instead.
+    for ( HAPI_AssetId VolumeAssetId : VolumeAssetIds )
+    {
+        if ( !FHoudiniEngineUtils::IsHoudiniAssetValid( VolumeAssetId ) )
+            return false;
+
+        HAPI_PartInfo PartInfo;
+        if ( FHoudiniApi::GetPartInfo(
+                FHoudiniEngine::Get().GetSession(), VolumeAssetId, 0, 0, 0, &PartInfo ) != HAPI_RESULT_SUCCESS
+            || PartInfo.type != HAPI_PARTTYPE_VOLUME )
+        {
+            return false;
+        }
+
+        HAPI_VolumeInfo VolumeInfo;
+        if ( FHoudiniApi::GetVolumeInfo(
+                FHoudiniEngine::Get().GetSession(), VolumeAssetId, 0, 0, 0, &VolumeInfo ) != HAPI_RESULT_SUCCESS
+            || VolumeInfo.xLength != Layout.SizeX || VolumeInfo.yLength != Layout.SizeY || VolumeInfo.zLength != 1
+            || VolumeInfo.tupleSize != 1 || VolumeInfo.storage != HAPI_STORAGETYPE_FLOAT )
+        {
+            return false;
+        }
+    }
+
+    // Collect the tiles covering the changed components.
+    const int32 TileSize = HAPI_UNREAL_VOLUME_TILE_SIZE;
+    TSet< FIntPoint > DirtyTiles;
+    FIntRect DirtyRect( TNumericLimits< int32 >::Max(), TNumericLimits< int32 >::Max(), 0, 0 );
+
+    for ( const TWeakObjectPtr< ULandscapeComponent > & DirtyComponent : DirtyComponents )
+    {
+        // Components deleted since they were changed are skipped.
+        ULandscapeComponent * LandscapeComponent = DirtyComponent.Get();
+        if ( !LandscapeComponent || LandscapeComponent->IsPendingKill() )
+            continue;
+
+        // Components of other proxies are not part of the volumes.
+        if ( LandscapeComponent->GetLandscapeProxy() != LandscapeProxy )
+            continue;
+
+        int32 ComponentMinX = TNumericLimits< int32 >::Max();
+        int32 ComponentMinY = TNumericLimits< int32 >::Max();
+        int32 ComponentMaxX = TNumericLimits< int32 >::Lowest();
+        int32 ComponentMaxY = TNumericLimits< int32 >::Lowest();
+        LandscapeComponent->GetComponentExtent( ComponentMinX, ComponentMinY, ComponentMaxX, ComponentMaxY );
+
+        // Voxel rows of the component, inclusive.
+        const int32 VoxelMinX = ComponentMinX - Layout.MinX;
+        const int32 VoxelMaxX = ComponentMaxX - Layout.MinX;
+        const int32 VoxelMinY = Layout.bFlipRows ? Layout.MaxY - ComponentMaxY : ComponentMinY - Layout.MinY;
+        const int32 VoxelMaxY = Layout.bFlipRows ? Layout.MaxY - ComponentMinY : ComponentMaxY - Layout.MinY;
+
+        for ( int32 TileY = VoxelMinY / TileSize; TileY <= VoxelMaxY / TileSize; ++TileY )
+        {
+            for ( int32 TileX = VoxelMinX / TileSize; TileX <= VoxelMaxX / TileSize; ++TileX )
+                DirtyTiles.Add( FIntPoint( TileX * TileSize, TileY * TileSize ) );
+        }
+
+        DirtyRect.Min.X = FMath::Min( DirtyRect.Min.X, ( VoxelMinX / TileSize ) * TileSize );
+        DirtyRect.Min.Y = FMath::Min( DirtyRect.Min.Y, ( VoxelMinY / TileSize ) * TileSize );
+        DirtyRect.Max.X = FMath::Max( DirtyRect.Max.X, FMath::Min( ( VoxelMaxX / TileSize + 1 ) * TileSize, Layout.SizeX ) );
+        DirtyRect.Max.Y = FMath::Max( DirtyRect.Max.Y, FMath::Min( ( VoxelMaxY / TileSize + 1 ) * TileSize, Layout.SizeY ) );
+    }
+
+    if ( DirtyTiles.Num() <= 0 )
+        return true;
+
+    // Only the dirty area is read back from the landscape, and only its tiles are uploaded.
+    FLandscapeEditDataInterface LandscapeEditDataInterface( LandscapeInfo );
+    TArray< float > Values;
+    TArray< float > TileValues;
+
+    for ( int32 VolumeIdx = 0; VolumeIdx < VolumeAssetIds.Num(); ++VolumeIdx )
+    {
+        const HAPI_AssetId VolumeAssetId = VolumeAssetIds[ VolumeIdx ];
+        HoudiniGetHeightfieldVolumeValues(
+            LandscapeEditDataInterface, VolumeLayerInfos[ VolumeIdx ], Layout, DirtyRect, Values );
+
+        for ( const FIntPoint & DirtyTile : DirtyTiles )
+        {
+            if ( !HoudiniSetHeightfieldVolumeTile( VolumeAssetId, Values, DirtyRect, DirtyTile.X, DirtyTile.Y, TileValues ) )
+                return false;
+        }
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+            FHoudiniEngine::Get().GetSession(), VolumeAssetId, 0, 0 ), false );
+    }
+
+#endif
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiCreateAndConnectAsset(
+    HAPI_AssetId HostAssetId,
+    int32 InputIndex,
+    USplineComponent * SplineComponent,
+    HAPI_AssetId & ConnectedAssetId,
+    FHoudiniAssetInputOutlinerMesh& OutlinerMesh,
+    const float& SplineResolution)
+{
+#if WITH_EDITOR
+
+    // If we don't have a spline component, or host asset is invalid, there's nothing to do.
+    if (!SplineComponent || !FHoudiniEngineUtils::IsHoudiniAssetValid(HostAssetId))
+        return false;
+
+    float fSplineResolution = SplineResolution;
+    if (fSplineResolution == -1.0f)
+    {
+        // Get runtime settings and extract the spline resolution from it
+        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+        if (HoudiniRuntimeSettings)
+            fSplineResolution = HoudiniRuntimeSettings->MarshallingSplineResolution;
+        else
+            fSplineResolution = HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT;
+    }
+
+    int32 nNumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
+    float fSplineLength = SplineComponent->GetSplineLength();
+
+    // Calculate the number of refined point we want
+    int32 nNumberOfRefinedSplinePoints = fSplineResolution > 0.0f ? ceil(fSplineLength / fSplineResolution) + 1 : nNumberOfControlPoints;
+
+    // Array that will store the attributes we want to add to the curves
+    TArray<FVector> tRefinedSplinePositions;
+    TArray<FQuat> tRefinedSplineRotations;
+    // Scale on Unreal's spline will require some tweaking, as the XScale is always 1
+    TArray<FVector> tRefinedSplineScales;
+    //TArray<float> tRefinedSplinePScales;
+
+    if ((nNumberOfRefinedSplinePoints < nNumberOfControlPoints) || (fSplineResolution <= 0.0f))
+    {
+        // There's not enough refined points, so we'll use the Spline CVs instead
+        tRefinedSplinePositions.SetNumZeroed(nNumberOfControlPoints);
+        tRefinedSplineRotations.SetNumZeroed(nNumberOfControlPoints);
+        tRefinedSplineScales.SetNumZeroed(nNumberOfControlPoints);
+        //tRefinedSplinePScales.SetNumZeroed(nNumberOfControlPoints);
+
+        FVector Scale;
+        for (int32 n = 0; n < nNumberOfControlPoints; n++)
+        {
+            tRefinedSplinePositions[n] = SplineComponent->GetLocationAtSplinePoint(n, ESplineCoordinateSpace::Local);
+            tRefinedSplineRotations[n] = SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World);
+            Scale = SplineComponent->GetScaleAtSplinePoint(n);
+            tRefinedSplineScales[n] = Scale;
+            // tRefinedSplinePScales[n] = (Scale.Y + Scale.Z) / 2.0f; //FMath::Max(Scale.Y, Scale.Z);
+        }
+    }
+    else
+    {
+        // Calculating the refined spline points
+        tRefinedSplinePositions.SetNumZeroed(nNumberOfRefinedSplinePoints);
+        tRefinedSplineRotations.SetNumZeroed(nNumberOfRefinedSplinePoints);
+        tRefinedSplineScales.SetNumZeroed(nNumberOfRefinedSplinePoints);
+        // tRefinedSplinePScales.SetNumZeroed(nNumberOfRefinedSplinePoints);
+
+        FVector Scale;
+        float fCurrentDistance = 0.0f;
+        for (int32 n = 0; n < nNumberOfRefinedSplinePoints; n++)
+        {
+            tRefinedSplinePositions[n] = SplineComponent->GetLocationAtDistanceAlongSpline(fCurrentDistance, ESplineCoordinateSpace::Local);
+            tRefinedSplineRotations[n] = SplineComponent->GetQuaternionAtDistanceAlongSpline(fCurrentDistance, ESplineCoordinateSpace::World);
+
+            Scale = SplineComponent->GetScaleAtDistanceAlongSpline(fCurrentDistance);
+
+            tRefinedSplineScales[n] = Scale;
+            // tRefinedSplinePScales[n] = (Scale.Y + Scale.Z) / 2.0f; //FMath::Max(Scale.Y, Scale.Z);
+
+            fCurrentDistance += fSplineResolution;
+        }
+    }
+
+    if (!HapiCreateCurveAsset(
+            HostAssetId, ConnectedAssetId,
+            &tRefinedSplinePositions,
+            &tRefinedSplineRotations,
+            &tRefinedSplineScales,
+            nullptr) )//&tRefinedSplinePScales) )
+        return false;
+
+    // Updating the OutlinerMesh's struct infos
+    OutlinerMesh.SplineResolution = fSplineResolution;
+    OutlinerMesh.SplineLength = fSplineLength;
+    OutlinerMesh.NumberOfSplineControlPoints = nNumberOfControlPoints;
+
+    // We also need to extract all the CV's Transform to check for modifications
+    OutlinerMesh.SplineControlPointsTransform.SetNum(nNumberOfControlPoints);
+    for (int32 n = 0; n < nNumberOfControlPoints; n++)
+    {
+        // Getting the Local Transform for positions and scale
+        OutlinerMesh.SplineControlPointsTransform[n] = SplineComponent->GetTransformAtSplinePoint(n, ESplineCoordinateSpace::Local, true);
+
+        // ... but we used we used the world rotation
+        OutlinerMesh.SplineControlPointsTransform[n].SetRotation(SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World));
+    }
+
+    // Cook the spline node.
+    HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookAsset(
+        FHoudiniEngine::Get().GetSession(),
+        ConnectedAssetId,
+        nullptr), false);
+
+    // Connect asset.
+    if (!FHoudiniEngineUtils::HapiConnectAsset(ConnectedAssetId, 0, HostAssetId, InputIndex))
+    {
+        ConnectedAssetId = -1;
+        return false;
+    }
+
+#endif
+
+    return true;
+}
+
+
+
+
+bool
+FHoudiniEngineUtils::HapiCreateAndConnectAsset(
+    HAPI_AssetId HostAssetId, 
+    int32 InputIndex, 
+    UStaticMesh * StaticMesh,
+    HAPI_AssetId & ConnectedAssetId)
+{
+#if WITH_EDITOR
+
+    // If we don't have a static mesh, or host asset is invalid, there's nothing to do.
+    if ( !StaticMesh || !FHoudiniEngineUtils::IsHoudiniAssetValid( HostAssetId ) )
+        return false;
+
+    // Check if connected asset id is valid, if it is not, we need to create an input asset.
+    if ( ConnectedAssetId < 0 )
+    {
+        HAPI_AssetId AssetId = -1;
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputAsset(
+            FHoudiniEngine::Get().GetSession(), &AssetId, nullptr ), false );
+
+        // Check if we have a valid id for this new input asset.
         if ( !FHoudiniEngineUtils::IsHoudiniAssetValid( AssetId ) )
             return false;
 
@@ -3569,26 +4601,129 @@ FHoudiniEngineUtils::HapiCreateAndConnectAsset(
     return true;
 }
 
+#if WITH_EDITOR
+
+inline
+uint32
+HoudiniGetStaticMeshInputContentHash( UStaticMesh * StaticMesh )
+{
+    // The raw mesh id changes whenever the source geometry is modified.
+    uint32 ContentHash = 0;
+    if ( StaticMesh->SourceModels.Num() > 0 && StaticMesh->SourceModels[ 0 ].RawMeshBulkData )
+        ContentHash = GetTypeHash( StaticMesh->SourceModels[ 0 ].RawMeshBulkData->GetIdString() );
+
+    // Other exported properties.
+    ContentHash = HashCombine( ContentHash, GetTypeHash( StaticMesh->LightMapResolution ) );
+    for ( const FStaticMaterial & StaticMaterial : StaticMesh->StaticMaterials )
+        ContentHash = HashCombine( ContentHash, GetTypeHash( StaticMaterial.MaterialInterface ) );
+
+    // Settings used by the upload.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+    {
+        ContentHash = HashCombine( ContentHash, GetTypeHash( HoudiniRuntimeSettings->GeneratedGeometryScaleFactor ) );
+        ContentHash = HashCombine( ContentHash, GetTypeHash( (int32) HoudiniRuntimeSettings->ImportAxis ) );
+    }
+
+    return ContentHash;
+}
+
+#endif
+
+bool
+FHoudiniEngineUtils::HapiAcquireAndConnectStaticMeshAsset(
+    HAPI_AssetId HostAssetId, int32 InputIndex, UStaticMesh * StaticMesh,
+    HAPI_AssetId & ConnectedAssetId )
+{
+#if WITH_EDITOR
+
+    if ( !StaticMesh || !FHoudiniEngineUtils::IsHoudiniAssetValid( HostAssetId ) )
+        return false;
+
+    FHoudiniEngine & HoudiniEngine = FHoudiniEngine::Get();
+    const uint32 ContentHash = HoudiniGetStaticMeshInputContentHash( StaticMesh );
+
+    // Reuse the asset another input has already uploaded.
+    HAPI_AssetId SharedAssetId = -1;
+    if ( HoudiniEngine.AcquireStaticMeshInputAsset( StaticMesh, ContentHash, SharedAssetId ) )
+    {
+        if ( FHoudiniEngineUtils::IsHoudiniAssetValid( SharedAssetId ) )
+        {
+            ConnectedAssetId = SharedAssetId;
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectAssetGeometry(
+                FHoudiniEngine::Get().GetSession(), ConnectedAssetId,
+                0, HostAssetId, InputIndex ), false );
+
+            return true;
+        }
+
+        // The shared asset is gone, it will be uploaded again.
+        HoudiniEngine.RemoveStaticMeshInputAsset( SharedAssetId );
+    }
+
+    ConnectedAssetId = -1;
+    if ( !FHoudiniEngineUtils::HapiCreateAndConnectAsset( HostAssetId, InputIndex, StaticMesh, ConnectedAssetId ) )
+        return false;
+
+    HoudiniEngine.AddStaticMeshInputAsset( StaticMesh, ContentHash, ConnectedAssetId );
+
+#endif
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiReleaseInputAsset( HAPI_AssetId AssetId )
+{
+    if ( !FHoudiniEngine::Get().ReleaseStaticMeshInputAsset( AssetId ) )
+        return true;
+
+    return FHoudiniEngineUtils::DestroyHoudiniAsset( AssetId );
+}
+
 bool
 FHoudiniEngineUtils::HapiCreateAndConnectAsset(
     HAPI_AssetId HostAssetId,
     int32 InputIndex,
     TArray< FHoudiniAssetInputOutlinerMesh > & OutlinerMeshArray,
     HAPI_AssetId & ConnectedAssetId,
+    TArray< HAPI_AssetId > & MergeInputAssetIds,
     const float& SplineResolution)
 {
     if ( OutlinerMeshArray.Num() <= 0 )
         return false;
 
-    // Create the merge SOP asset. This will be our "ConnectedAssetId".
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::InstantiateAsset(
-        FHoudiniEngine::Get().GetSession(),
-        "SOP/merge", true, &ConnectedAssetId ), false );
+    // Create the merge SOP asset if we don't have one yet. This will be our "ConnectedAssetId".
+    if ( !FHoudiniEngineUtils::IsValidAssetId( ConnectedAssetId ) || !FHoudiniEngineUtils::IsHoudiniAssetValid( ConnectedAssetId ) )
+    {
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::InstantiateAsset(
+            FHoudiniEngine::Get().GetSession(),
+            "SOP/merge", true, &ConnectedAssetId ), false );
+
+        MergeInputAssetIds.Empty();
+    }
 
+    // Only the actors without a valid input asset are exported, the others are reconnected if their slot changed.
     for ( int32 InputIdx = 0; InputIdx < OutlinerMeshArray.Num(); ++InputIdx )
     {
         auto & OutlinerMesh = OutlinerMeshArray[ InputIdx ];
-        
+        const bool bSlotConnected = MergeInputAssetIds.IsValidIndex( InputIdx ) && MergeInputAssetIds[ InputIdx ] >= 0;
+
+        if ( FHoudiniEngineUtils::IsValidAssetId( OutlinerMesh.AssetId )
+            && FHoudiniEngineUtils::IsHoudiniAssetValid( OutlinerMesh.AssetId ) )
+        {
+            if ( !bSlotConnected || MergeInputAssetIds[ InputIdx ] != OutlinerMesh.AssetId )
+            {
+                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectAssetGeometry(
+                    FHoudiniEngine::Get().GetSession(), OutlinerMesh.AssetId, 0, ConnectedAssetId, InputIdx ), false );
+            }
+
+            continue;
+        }
+
+        OutlinerMesh.AssetId = -1;
+
         bool bInputCreated = false;
         if (OutlinerMesh.StaticMesh != nullptr)
         {
@@ -3614,10 +4749,14 @@ FHoudiniEngineUtils::HapiCreateAndConnectAsset(
         if ( !bInputCreated )
         {
             OutlinerMesh.AssetId = -1;
+
+            // Don't leave the asset of another actor in this slot.
+            if ( bSlotConnected )
+                FHoudiniEngineUtils::HapiDisconnectAsset( ConnectedAssetId, InputIdx );
+
             continue;
         }
 
-        
         // Updating the Transform
         HAPI_TransformEuler HapiTransform;
         FHoudiniEngineUtils::TranslateUnrealTransform( OutlinerMesh.ComponentTransform, HapiTransform );
@@ -3627,6 +4766,17 @@ FHoudiniEngineUtils::HapiCreateAndConnectAsset(
             OutlinerMesh.AssetId, &HapiTransform ), false );
     }
 
+    // Disconnect the slots of removed actors.
+    for ( int32 InputIdx = OutlinerMeshArray.Num(); InputIdx < MergeInputAssetIds.Num(); ++InputIdx )
+    {
+        if ( MergeInputAssetIds[ InputIdx ] >= 0 )
+            FHoudiniEngineUtils::HapiDisconnectAsset( ConnectedAssetId, InputIdx );
+    }
+
+    MergeInputAssetIds.SetNum( OutlinerMeshArray.Num() );
+    for ( int32 InputIdx = 0; InputIdx < OutlinerMeshArray.Num(); ++InputIdx )
+        MergeInputAssetIds[ InputIdx ] = OutlinerMeshArray[ InputIdx ].AssetId;
+
     // Now we can connect assets together.
     HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectAssetGeometry(
         FHoudiniEngine::Get().GetSession(), ConnectedAssetId, 0, HostAssetId, InputIndex ), false );
@@ -3651,7 +4801,7 @@ FHoudiniEngineUtils::HapiCreateAndConnectAsset( HAPI_AssetId HostAssetId, int32
             {
                 HAPI_AssetId MeshAssetNodeId = -1;
                 // Creating an Input Node for Mesh Data
-                bool bInputCreated = HapiCreateAndConnectAsset( ConnectedAssetId, InputIdx, InputStaticMesh, MeshAssetNodeId );
+                bool bInputCreated = HapiAcquireAndConnectStaticMeshAsset( ConnectedAssetId, InputIdx, InputStaticMesh, MeshAssetNodeId );
                 if ( !bInputCreated )
                 {
                     HOUDINI_LOG_WARNING( TEXT( "Error creating input index %d on %d" ), InputIdx, ConnectedAssetId );
@@ -3888,6 +5038,43 @@ FHoudiniEngineUtils::BakeCreateStaticMeshPackageForComponent(
     return PackageNew;
 }
 
+#if WITH_EDITOR
+
+bool
+FHoudiniEngineUtils::CreatePackageForTransientStaticMesh(
+    UHoudiniAssetComponent * HoudiniAssetComponent,
+    const FHoudiniGeoPartObject & HoudiniGeoPartObject, UStaticMesh * StaticMesh )
+{
+    if ( !HoudiniAssetComponent || !StaticMesh || StaticMesh->GetOutermost() != GetTransientPackage() )
+        return false;
+
+    FString MeshName;
+    FGuid MeshGuid;
+    UPackage * MeshPackage = FHoudiniEngineUtils::BakeCreateStaticMeshPackageForComponent(
+        HoudiniAssetComponent, HoudiniGeoPartObject, MeshName, MeshGuid, FHoudiniEngineUtils::EBakeMode::Intermediate );
+    if ( !MeshPackage )
+        return false;
+
+    if ( !StaticMesh->Rename( *MeshName, MeshPackage, REN_DontCreateRedirectors | REN_NonTransactional ) )
+        return false;
+
+    // Add meta information to this package.
+    FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
+        MeshPackage, MeshPackage,
+        HAPI_UNREAL_PACKAGE_META_GENERATED_OBJECT, TEXT( "true" ) );
+    FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
+        MeshPackage, MeshPackage,
+        HAPI_UNREAL_PACKAGE_META_GENERATED_NAME, *MeshName );
+
+    // Notify system that new asset has been created.
+    FAssetRegistryModule::AssetCreated( StaticMesh );
+    MeshPackage->MarkPackageDirty();
+
+    return true;
+}
+
+#endif
+
 UPackage *
 FHoudiniEngineUtils::BakeCreateBlueprintPackageForComponent(
     UHoudiniAssetComponent * HoudiniAssetComponent,
@@ -4236,13 +5423,27 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
     if ( !FHoudiniEngineUtils::IsHoudiniAssetValid( AssetId ) || !HoudiniAsset )
         return false;
 
-    // Make sure rendering is done - so we are not changing data being used by collision drawing.
-    FlushRenderingCommands();
-
     // Get runtime settings.
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
     check( HoudiniRuntimeSettings );
 
+    // Meshes currently displayed are not modified while cooking, so rendering does not need to be flushed. Only the
+    // fallbacks attaching leftover collisions to an existing mesh may modify one, rendering is flushed first then,
+    // so we are not changing data being used by collision drawing.
+    TSet< UStaticMesh * > DisplayedStaticMeshes;
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( StaticMeshesIn ); Iter; ++Iter )
+        DisplayedStaticMeshes.Add( Iter.Value() );
+
+    bool bRenderingFlushed = false;
+    auto FlushRenderingIfDisplayed = [ & ]( UStaticMesh * StaticMesh )
+    {
+        if ( !bRenderingFlushed && DisplayedStaticMeshes.Contains( StaticMesh ) )
+        {
+            FlushRenderingCommands();
+            bRenderingFlushed = true;
+        }
+    };
+
     float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
     EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
 
@@ -4316,9 +5517,75 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
     TArray< float > Colors;
     TArray< float > Alphas;
     TArray< FString > FaceMaterials;
-    TArray< int32 > FaceSmoothingMasks;
     TArray< int32 > LightMapResolutions;
 
+    // Per part and per split scratch containers. These live for the whole cook and are only reset between
+    // parts and splits, so their allocations get reused instead of being made again for each of them.
+    TArray< HAPI_MaterialId > FaceMaterialIds;
+    TArray< int32 > FaceLODs;
+    TArray< int32 > AllCollisionVertexList;
+    TArray< int32 > AllCollisionFaceIndices;
+    FRawMesh RawMesh;
+
+#if STATS
+    // Scratch usage, published once the cook is done. Without reuse, each container holding data for a split
+    // would have been allocated for it. With reuse, a container is only allocated again when it has to grow.
+    TArray< SIZE_T > ScratchContainerSizes;
+    TArray< SIZE_T > PreviousScratchContainerSizes;
+    uint32 ScratchSplitCount = 0;
+    uint32 ScratchAllocationCount = 0;
+    uint32 ScratchUsedContainerCount = 0;
+    SIZE_T ScratchPeakSize = 0;
+    auto UpdateScratchStatistics = [ & ]()
+    {
+        ScratchContainerSizes.Reset();
+        ScratchContainerSizes.Add( VertexList.GetAllocatedSize() );
+        ScratchContainerSizes.Add( Positions.GetAllocatedSize() );
+        ScratchContainerSizes.Add( Normals.GetAllocatedSize() );
+        ScratchContainerSizes.Add( Colors.GetAllocatedSize() );
+        ScratchContainerSizes.Add( Alphas.GetAllocatedSize() );
+        ScratchContainerSizes.Add( FaceMaterials.GetAllocatedSize() );
+        ScratchContainerSizes.Add( LightMapResolutions.GetAllocatedSize() );
+        ScratchContainerSizes.Add( FaceMaterialIds.GetAllocatedSize() );
+        ScratchContainerSizes.Add( FaceLODs.GetAllocatedSize() );
+        ScratchContainerSizes.Add( AllCollisionVertexList.GetAllocatedSize() );
+        ScratchContainerSizes.Add( AllCollisionFaceIndices.GetAllocatedSize() );
+        ScratchContainerSizes.Add( RawMesh.FaceMaterialIndices.GetAllocatedSize() );
+        ScratchContainerSizes.Add( RawMesh.FaceSmoothingMasks.GetAllocatedSize() );
+        ScratchContainerSizes.Add( RawMesh.VertexPositions.GetAllocatedSize() );
+        ScratchContainerSizes.Add( RawMesh.WedgeIndices.GetAllocatedSize() );
+        ScratchContainerSizes.Add( RawMesh.WedgeTangentX.GetAllocatedSize() );
+        ScratchContainerSizes.Add( RawMesh.WedgeTangentY.GetAllocatedSize() );
+        ScratchContainerSizes.Add( RawMesh.WedgeTangentZ.GetAllocatedSize() );
+        ScratchContainerSizes.Add( RawMesh.WedgeColors.GetAllocatedSize() );
+
+        for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
+            ScratchContainerSizes.Add( TextureCoordinates[ TexCoordIdx ].GetAllocatedSize() );
+
+        for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_MESH_TEXTURE_COORDS; ++TexCoordIdx )
+            ScratchContainerSizes.Add( RawMesh.WedgeTexCoords[ TexCoordIdx ].GetAllocatedSize() );
+
+        if ( PreviousScratchContainerSizes.Num() != ScratchContainerSizes.Num() )
+            PreviousScratchContainerSizes.SetNumZeroed( ScratchContainerSizes.Num() );
+
+        SIZE_T ScratchSize = 0;
+        for ( int32 ContainerIdx = 0; ContainerIdx < ScratchContainerSizes.Num(); ++ContainerIdx )
+        {
+            // Containers are only ever reset during the cook, so any size increase means they had to grow.
+            if ( ScratchContainerSizes[ ContainerIdx ] > PreviousScratchContainerSizes[ ContainerIdx ] )
+                ScratchAllocationCount++;
+
+            if ( ScratchContainerSizes[ ContainerIdx ] > 0 )
+                ScratchUsedContainerCount++;
+
+            ScratchSize += ScratchContainerSizes[ ContainerIdx ];
+        }
+
+        Swap( ScratchContainerSizes, PreviousScratchContainerSizes );
+        ScratchPeakSize = FMath::Max( ScratchPeakSize, ScratchSize );
+    };
+#endif
+
     // Retrieve all used unique material ids.
     TSet< HAPI_MaterialId > UniqueMaterialIds;
     TSet< HAPI_MaterialId > UniqueInstancerMaterialIds;
@@ -4343,6 +5610,58 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
     FString MeshName;
     FGuid MeshGuid;
 
+    // Meshes whose collision has changed, their navigation collision and physics state are refreshed at the end.
+    TSet< UStaticMesh * > CollisionChangedStaticMeshes;
+
+    // Meshes built with preview settings during this cook.
+    TSet< UStaticMesh * > PreviewBuiltStaticMeshes;
+
+    // Meshes shared by identical parts, by content hash, and the position of their first vertex. Meshes which were
+    // shared after the previous cook are never reused as is or rebuilt in place, other parts may still use them.
+    TMap< FSHAHash, UStaticMesh * > SharedStaticMeshes;
+    TMap< UStaticMesh *, FVector > SharedStaticMeshOrigins;
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( StaticMeshesIn ); Iter; ++Iter )
+    {
+        UStaticMesh * SharedStaticMesh = Iter.Value();
+        const FSHAHash * FoundContentHash = HoudiniAssetComponent->SharedStaticMeshHashes.Find( SharedStaticMesh );
+        const FVector * FoundOrigin = HoudiniAssetComponent->SharedStaticMeshOrigins.Find( SharedStaticMesh );
+        if ( SharedStaticMesh && FoundContentHash && FoundOrigin )
+        {
+            SharedStaticMeshes.Add( *FoundContentHash, SharedStaticMesh );
+            SharedStaticMeshOrigins.Add( SharedStaticMesh, *FoundOrigin );
+        }
+    }
+
+    // Content hash and first vertex position of the parts using shared meshes. Parts whose geometry and materials
+    // have not changed find their shared mesh again from these, without reading and hashing their geometry.
+    TMap< FHoudiniGeoPartObject, FSHAHash > SharedGeoPartHashes;
+    TMap< FHoudiniGeoPartObject, FVector > SharedGeoPartOrigins;
+
+    // Positions of shared meshes, loaded when a part matches their hash to confirm that its content is the same.
+    TMap< UStaticMesh *, TArray< FVector > > SharedStaticMeshPositions;
+    auto GetSharedStaticMeshPositions = [ & ]( UStaticMesh * SharedStaticMesh ) -> const TArray< FVector > &
+    {
+        TArray< FVector > * FoundPositions = SharedStaticMeshPositions.Find( SharedStaticMesh );
+        if ( FoundPositions )
+            return *FoundPositions;
+
+        FRawMesh SharedRawMesh;
+        if ( SharedStaticMesh->SourceModels.Num() > 0 )
+            SharedStaticMesh->SourceModels[ 0 ].RawMeshBulkData->LoadRawMesh( SharedRawMesh );
+
+        return SharedStaticMeshPositions.Add( SharedStaticMesh, MoveTemp( SharedRawMesh.VertexPositions ) );
+    };
+
+    // Raw meshes combining small parts, stored under the part representing them, with the material and lightmap
+    // coordinate index shared by the merged parts.
+    TMap< FHoudiniGeoPartObject, FRawMesh > MergedRawMeshes;
+    TMap< FHoudiniGeoPartObject, FStaticMaterial > MergedStaticMaterials;
+    TMap< FHoudiniGeoPartObject, int32 > MergedLightMapCoordinateIndices;
+
+    // Transient mesh the materials of parts which may be merged are resolved on. It is reused by all these parts,
+    // unless one of them keeps it as its own mesh.
+    UStaticMesh * MergeScratchStaticMesh = nullptr;
+
     // Iterate through all objects.
     for ( int32 ObjectIdx = 0; ObjectIdx < ObjectInfos.Num(); ++ObjectIdx )
     {
@@ -4464,6 +5783,18 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 }
             }
 
+            // Detect if this object provides hand made LODs through lod1, lod2, ... groups.
+            // LOD 0 is always the main geometry.
+            bool bHasLODGroups = false;
+            for ( int32 GeoGroupNameIdx = 0; GeoGroupNameIdx < ObjectGeoGroupNames.Num(); ++GeoGroupNameIdx )
+            {
+                if ( FHoudiniEngineUtils::GetLODIndexFromGroupName( ObjectGeoGroupNames[ GeoGroupNameIdx ] ) > 0 )
+                {
+                    bHasLODGroups = true;
+                    break;
+                }
+            }
+
             // Prepare the object that will store UCX/UBX/USP Collision geo
             FKAggregateGeom AggregateCollisionGeo;
             bool bHasAggregateGeometryCollision = false;
@@ -4544,7 +5875,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 }
 
                 // Retrieve material information for this geo part.
-                TArray< HAPI_MaterialId > FaceMaterialIds;
+                FaceMaterialIds.Reset();
                 HAPI_Bool bSingleFaceMaterial = false;
                 bool bMaterialsFound = false;
                 bool bMaterialsChanged = false;
@@ -4696,11 +6027,8 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 }
 
                 // Retrieve all vertex indices.
-                VertexList.SetNumUninitialized( PartInfo.vertexCount );
-
-                if ( FHoudiniApi::GetVertexList(
-                    FHoudiniEngine::Get().GetSession(), AssetId, ObjectInfo.id, GeoInfo.id, PartInfo.id,
-                    &VertexList[ 0 ], 0, PartInfo.vertexCount ) != HAPI_RESULT_SUCCESS )
+                if ( !FHoudiniEngineUtils::HapiGetVertexList(
+                    AssetId, ObjectInfo.id, GeoInfo.id, PartInfo.id, PartInfo.vertexCount, VertexList ) )
                 {
                     // Error getting the vertex list.
                     HOUDINI_LOG_MESSAGE(
@@ -4711,6 +6039,46 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     continue;
                 }
 
+                // Retrieve per primitive LOD indices, if this part provides them.
+                HAPI_AttributeInfo AttribInfoLODs;
+                FMemory::Memset< HAPI_AttributeInfo >( AttribInfoLODs, 0 );
+
+                FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+                    AssetId, ObjectInfo.id, GeoInfo.id, PartInfo.id,
+                    HAPI_UNREAL_ATTRIB_LOD, AttribInfoLODs, FaceLODs, 1 );
+
+                if ( AttribInfoLODs.exists && AttribInfoLODs.owner != HAPI_ATTROWNER_PRIM )
+                {
+                    HOUDINI_LOG_WARNING( TEXT( "Static Mesh [%d %s], Geo [%d], Part [%d %s]: unreal_lod must be a primitive attribute, ignoring attribute." ),
+                        ObjectInfo.nodeId, *ObjectName, GeoIdx, PartIdx, *PartName );
+                    FaceLODs.Reset();
+                }
+
+                // Small parts may be merged, unless the part overrides the setting with a detail attribute.
+                bool bMergeSmallPart = HoudiniRuntimeSettings->bMergeSmallGeoParts;
+                {
+                    HAPI_AttributeInfo AttribInfoMergeSmallParts;
+                    FMemory::Memset< HAPI_AttributeInfo >( AttribInfoMergeSmallParts, 0 );
+                    TArray< int32 > MergeSmallParts;
+
+                    FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+                        AssetId, ObjectInfo.id, GeoInfo.id, PartInfo.id,
+                        HAPI_UNREAL_ATTRIB_MERGE_SMALL_PARTS, AttribInfoMergeSmallParts, MergeSmallParts, 1 );
+
+                    if ( AttribInfoMergeSmallParts.exists && AttribInfoMergeSmallParts.owner == HAPI_ATTROWNER_DETAIL && MergeSmallParts.Num() > 0 )
+                        bMergeSmallPart = MergeSmallParts[ 0 ] != 0;
+                }
+
+                bool bHasLODAttribute = false;
+                for ( int32 FaceIdx = 0; FaceIdx < FaceLODs.Num(); ++FaceIdx )
+                {
+                    if ( FaceLODs[ FaceIdx ] > 0 )
+                    {
+                        bHasLODAttribute = true;
+                        break;
+                    }
+                }
+
                 // See if we require splitting.
                 TMap< FString, TArray< int32 > > GroupSplitFaces;
                 TMap< FString, int32 > GroupSplitFaceCounts;
@@ -4719,16 +6087,16 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 int32 GroupVertexListCount = 0;
                 static const FString RemainingGroupName = TEXT( HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION );
 
-                if ( bIsRenderCollidable || bIsCollidable || bIsUCXCollidable )
+                if ( bIsRenderCollidable || bIsCollidable || bIsUCXCollidable || bHasLODGroups || bHasLODAttribute )
                 {
                     // Buffer for all vertex indices used for collision. We need this to figure out all vertex
                     // indices that are not part of collision geos.
-                    TArray< int32 > AllCollisionVertexList;
+                    AllCollisionVertexList.Reset();
                     AllCollisionVertexList.SetNumZeroed( VertexList.Num() );
 
                     // Buffer for all face indices used for collision. We need this to figure out all face indices
                     // that are not part of collision geos.
-                    TArray< int32 > AllCollisionFaceIndices;
+                    AllCollisionFaceIndices.Reset();
                     AllCollisionFaceIndices.SetNumZeroed( FaceMaterialIds.Num() );
 
                     for ( int32 GeoGroupNameIdx = 0; GeoGroupNameIdx < ObjectGeoGroupNames.Num(); ++GeoGroupNameIdx )
@@ -4752,7 +6120,8 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 ESearchCase::IgnoreCase) ) || 
                             ( !HoudiniRuntimeSettings->SimpleCollisionGroupNamePrefix.IsEmpty() &&
                                 GroupName.StartsWith( HoudiniRuntimeSettings->SimpleCollisionGroupNamePrefix,
-                                ESearchCase::IgnoreCase) ) )
+                                ESearchCase::IgnoreCase) ) ||
+                            ( !bHasLODAttribute && FHoudiniEngineUtils::GetLODIndexFromGroupName( GroupName ) > 0 ) )
                         {
                             // New vertex list just for this group.
                             TArray< int32 > GroupVertexList;
@@ -4773,6 +6142,38 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         }
                     }
 
+                    // LODs provided through the LOD attribute take precedence over LOD groups.
+                    if ( bHasLODAttribute )
+                    {
+                        TArray< int32 > UniqueFaceLODs;
+                        for ( int32 FaceIdx = 0; FaceIdx < FaceLODs.Num(); ++FaceIdx )
+                        {
+                            if ( FaceLODs[ FaceIdx ] > 0 )
+                                UniqueFaceLODs.AddUnique( FaceLODs[ FaceIdx ] );
+                        }
+
+                        for ( int32 LODIdx = 0; LODIdx < UniqueFaceLODs.Num(); ++LODIdx )
+                        {
+                            const FString LODGroupName = FString::Printf(
+                                TEXT( "%s%d" ), TEXT( HAPI_UNREAL_GROUP_LOD_PREFIX ), UniqueFaceLODs[ LODIdx ] );
+
+                            // New vertex list just for this LOD.
+                            TArray< int32 > GroupVertexList;
+                            TArray< int32 > AllFaceList;
+
+                            GroupVertexListCount = FHoudiniEngineUtils::GetVertexListForLOD(
+                                UniqueFaceLODs[ LODIdx ], FaceLODs, VertexList, GroupVertexList,
+                                AllCollisionVertexList, AllFaceList, AllCollisionFaceIndices );
+
+                            if ( GroupVertexListCount > 0 )
+                            {
+                                GroupSplitFaces.Add( LODGroupName, GroupVertexList );
+                                GroupSplitFaceCounts.Add( LODGroupName, GroupVertexListCount );
+                                GroupSplitFaceIndices.Add( LODGroupName, AllFaceList );
+                            }
+                        }
+                    }
+
                     // We also need to figure out / construct vertex list for everything that's not collision geometry
                     // or rendered collision geometry.
                     TArray< int32 > GroupSplitFacesRemaining;
@@ -4826,15 +6227,52 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     GroupSplitFaceIndices.Add( RemainingGroupName, AllFaces );
                 }
 
+                // Imported LODs are stored as additional source models of the main geometry's mesh, so they
+                // need to be processed after all other splits and in increasing LOD order.
+                TArray< FString > SplitGroupNames;
+                TArray< FString > ImportedLODSplitNames;
+                for ( TMap< FString, TArray< int32 > >::TIterator IterGroups( GroupSplitFaces ); IterGroups; ++IterGroups )
+                {
+                    if ( FHoudiniEngineUtils::GetLODIndexFromGroupName( IterGroups.Key() ) > 0 )
+                        ImportedLODSplitNames.Add( IterGroups.Key() );
+                    else
+                        SplitGroupNames.Add( IterGroups.Key() );
+                }
+
+                ImportedLODSplitNames.Sort( []( const FString & A, const FString & B )
+                {
+                    return FHoudiniEngineUtils::GetLODIndexFromGroupName( A ) < FHoudiniEngineUtils::GetLODIndexFromGroupName( B );
+                } );
+
+                if ( ImportedLODSplitNames.Num() > 0 && !GroupSplitFaces.Contains( RemainingGroupName ) )
+                {
+                    HOUDINI_LOG_MESSAGE(
+                        TEXT( "Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] has LODs but no main geometry " )
+                        TEXT( "- skipping LODs." ),
+                        ObjectIdx, *ObjectName, GeoIdx, PartIdx, *PartName );
+                    ImportedLODSplitNames.Empty();
+                }
+
+                SplitGroupNames.Append( ImportedLODSplitNames );
+
+                // Mesh of the main geometry, set while its build is deferred until all imported LODs are stored.
+                UStaticMesh * LODBaseStaticMesh = nullptr;
+                UStaticMesh * LODBasePreviousStaticMesh = nullptr;
+
                 // Keep track of split id.
                 int32 SplitId = 0;
 
                 // Iterate through all detected split groups we care about and split geometry.
-                for ( TMap< FString, TArray< int32 > >::TIterator IterGroups( GroupSplitFaces ); IterGroups; ++IterGroups )
+                for ( int32 SplitGroupIdx = 0; SplitGroupIdx < SplitGroupNames.Num(); ++SplitGroupIdx )
                 {
+#if STATS
+                    UpdateScratchStatistics();
+                    ScratchSplitCount++;
+#endif
+
                     // Get split group name and vertex indices.
-                    const FString & SplitGroupName = IterGroups.Key();
-                    TArray< int32 > & SplitGroupVertexList = IterGroups.Value();
+                    const FString & SplitGroupName = SplitGroupNames[ SplitGroupIdx ];
+                    TArray< int32 > & SplitGroupVertexList = GroupSplitFaces[ SplitGroupName ];
 
                     // Get valid count of vertex indices for this split.
                     int32 SplitGroupVertexListCount = GroupSplitFaceCounts[ SplitGroupName ];
@@ -4934,45 +6372,69 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                         bAlreadyCalledGetPositions = true;
 
-                        // We're only interested in the unique vertices
-                        TArray<int32> UniqueVertexIndexes;
-                        for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++ )
+                        // We're only interested in the unique vertices, either as a single piece or
+                        // one piece per connected part of the collision geo.
+                        int32 PointCount = Positions.Num() / 3;
+                        TArray< TArray< int32 > > PiecePointIndices;
+                        if ( HoudiniRuntimeSettings->bSplitUCXCollisionByConnectivity )
                         {
-                            int32 Index = SplitGroupVertexList[VertexIdx];
-                            if ( Index < 0 || (Index >= Positions.Num() ) )
-                                continue;
-
-                            UniqueVertexIndexes.AddUnique( Index );
+                            FHoudiniEngineUtils::GetConnectedPointPieces( SplitGroupVertexList, PointCount, PiecePointIndices );
                         }
-                            
-                        // Extract the collision geo's vertices
-                        TArray< FVector > VertexArray;
-                        VertexArray.SetNum(UniqueVertexIndexes.Num());
-                        for ( int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++ )
+                        else
                         {
-                            int32 VertexIndex = UniqueVertexIndexes[Idx];
+                            TArray< bool > UsedPoints;
+                            UsedPoints.SetNumZeroed( PointCount );
 
-                            VertexArray[Idx].X = Positions[VertexIndex * 3 + 0] * GeneratedGeometryScaleFactor;
-                            if ( ImportAxis == HRSAI_Unreal )
+                            TArray< int32 > & UniqueVertexIndexes = PiecePointIndices[ PiecePointIndices.AddDefaulted() ];
+                            for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++ )
                             {
-                                VertexArray[Idx].Y = Positions[VertexIndex * 3 + 2] * GeneratedGeometryScaleFactor;
-                                VertexArray[Idx].Z = Positions[VertexIndex * 3 + 1] * GeneratedGeometryScaleFactor;
+                                int32 Index = SplitGroupVertexList[ VertexIdx ];
+                                if ( Index < 0 || ( Index >= PointCount ) || UsedPoints[ Index ] )
+                                    continue;
+
+                                UsedPoints[ Index ] = true;
+                                UniqueVertexIndexes.Add( Index );
                             }
-                            else
+                        }
+
+                        TArray< FVector > VertexArray;
+                        for ( int32 PieceIdx = 0; PieceIdx < PiecePointIndices.Num(); ++PieceIdx )
+                        {
+                            const TArray< int32 > & UniqueVertexIndexes = PiecePointIndices[ PieceIdx ];
+
+                            // Extract the collision geo's vertices
+                            VertexArray.SetNum( UniqueVertexIndexes.Num() );
+                            for ( int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++ )
                             {
-                                VertexArray[Idx].Y = Positions[VertexIndex * 3 + 1] * GeneratedGeometryScaleFactor;
-                                VertexArray[Idx].Z = Positions[VertexIndex * 3 + 2] * GeneratedGeometryScaleFactor;
+                                int32 VertexIndex = UniqueVertexIndexes[ Idx ];
+
+                                VertexArray[ Idx ].X = Positions[ VertexIndex * 3 + 0 ] * GeneratedGeometryScaleFactor;
+                                if ( ImportAxis == HRSAI_Unreal )
+                                {
+                                    VertexArray[ Idx ].Y = Positions[ VertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
+                                    VertexArray[ Idx ].Z = Positions[ VertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
+                                }
+                                else
+                                {
+                                    VertexArray[ Idx ].Y = Positions[ VertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
+                                    VertexArray[ Idx ].Z = Positions[ VertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
+                                }
                             }
-                        }
 
-                        // Creating Convex collision
-                        FKConvexElem ConvexCollision;
-                        ConvexCollision.VertexData = VertexArray;
-                        ConvexCollision.UpdateElemBox();
+                            // Creating Convex collision, only keeping the vertices of the hull.
+                            FKConvexElem ConvexCollision;
+                            FHoudiniEngineUtils::ComputeConvexHull(
+                                VertexArray, HoudiniRuntimeSettings->UCXCollisionMaxHullVertices, ConvexCollision.VertexData );
 
-                        AggregateCollisionGeo.ConvexElems.Add( ConvexCollision );
+                            if ( ConvexCollision.VertexData.Num() <= 0 )
+                                continue;
+
+                            ConvexCollision.UpdateElemBox();
 
-                        bCollisionCreated = true;
+                            AggregateCollisionGeo.ConvexElems.Add( ConvexCollision );
+
+                            bCollisionCreated = true;
+                        }
 
                         // We'll add the collision after all the meshes are generated
                         // unless this a rendered_collision_geo_ucx
@@ -4986,8 +6448,21 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     // Record split group name.
                     HoudiniGeoPartObject.SplitName = SplitGroupName;
 
+                    // Imported LODs go in the following source models of the main geometry's mesh.
+                    int32 SourceModelIdx = 0;
+                    if ( ImportedLODSplitNames.Find( SplitGroupName, SourceModelIdx ) )
+                        SourceModelIdx++;
+
+                    // The main geometry's mesh will be built once all of its LODs have been stored.
+                    bool bDeferStaticMeshBuild = ( ImportedLODSplitNames.Num() > 0 ) && ( SplitGroupName == RemainingGroupName );
+
+                    // Main geometry was reused as is, or could not be created, so there is nothing to add this LOD to.
+                    if ( SourceModelIdx > 0 && !LODBaseStaticMesh )
+                        continue;
+
                     // Attempt to locate static mesh from previous instantiation.
-                    UStaticMesh * const * FoundStaticMesh = StaticMeshesIn.Find( HoudiniGeoPartObject );
+                    UStaticMesh * const * FoundStaticMesh = ( SourceModelIdx > 0 ) ?
+                        &LODBaseStaticMesh : StaticMeshesIn.Find( HoudiniGeoPartObject );
 
                     // Flag whether we need to rebuild the mesh.
                     bool bRebuildStaticMesh = false;
@@ -5001,6 +6476,61 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     if ( HoudiniAssetComponent->bManualRecookRequested )
                         bRebuildStaticMesh = true;
 
+                    // A shared mesh is never reused as is or rebuilt in place. The part finds the shared mesh matching
+                    // its current content again, along with its own offset.
+                    bool bReuseSharedGeoPart = false;
+                    if ( FoundStaticMesh && *FoundStaticMesh && SharedStaticMeshOrigins.Contains( *FoundStaticMesh ) )
+                    {
+                        bReuseSharedGeoPart = !bRebuildStaticMesh && !bMaterialsChanged;
+                        FoundStaticMesh = nullptr;
+                        bRebuildStaticMesh = true;
+                    }
+
+                    // Only plain visible geometry is shared between identical parts.
+                    bool bShareStaticMesh = HoudiniRuntimeSettings->bShareIdenticalGeoParts &&
+                        SplitGroupNames.Num() == 1 && SplitGroupName == RemainingGroupName &&
+                        HoudiniGeoPartObject.IsVisible() && !HoudiniGeoPartObject.IsCollidable() &&
+                        !HoudiniGeoPartObject.IsRenderCollidable() && AllSockets.Num() == 0 &&
+                        !bHasAggregateGeometryCollision;
+
+                    // Small plain geometry is merged with the small parts sharing its transform and material. These
+                    // parts have no mesh of their own, so their raw mesh is always read again.
+                    bool bMergeStaticMesh = bMergeSmallPart &&
+                        SplitGroupNames.Num() == 1 && SplitGroupName == RemainingGroupName &&
+                        HoudiniGeoPartObject.IsVisible() && !HoudiniGeoPartObject.IsCollidable() &&
+                        !HoudiniGeoPartObject.IsRenderCollidable() && AllSockets.Num() == 0 &&
+                        !bHasAggregateGeometryCollision &&
+                        SplitGroupFaceIndices.Num() < HoudiniRuntimeSettings->SmallGeoPartTriangleThreshold;
+
+                    if ( bMergeStaticMesh )
+                    {
+                        FoundStaticMesh = nullptr;
+                        bRebuildStaticMesh = true;
+                        bShareStaticMesh = false;
+                    }
+
+                    if ( bShareStaticMesh && bReuseSharedGeoPart )
+                    {
+                        // The content of this part has not changed, it is looked up with the hash of the previous cook.
+                        const FSHAHash * CachedContentHash = HoudiniAssetComponent->SharedGeoPartHashes.Find( HoudiniGeoPartObject );
+                        const FVector * CachedContentOrigin = HoudiniAssetComponent->SharedGeoPartOrigins.Find( HoudiniGeoPartObject );
+                        UStaticMesh * const * CachedSharedStaticMesh =
+                            CachedContentHash ? SharedStaticMeshes.Find( *CachedContentHash ) : nullptr;
+
+                        if ( CachedSharedStaticMesh && CachedContentOrigin )
+                        {
+                            StaticMesh = *CachedSharedStaticMesh;
+
+                            FVector ContentOffset = *CachedContentOrigin - SharedStaticMeshOrigins[ StaticMesh ];
+                            HoudiniGeoPartObject.TransformMatrix = FTransform( ContentOffset ) * HoudiniGeoPartObject.TransformMatrix;
+
+                            SharedGeoPartHashes.Add( HoudiniGeoPartObject, *CachedContentHash );
+                            SharedGeoPartOrigins.Add( HoudiniGeoPartObject, *CachedContentOrigin );
+                            StaticMeshesOut.Add( HoudiniGeoPartObject, StaticMesh );
+                            continue;
+                        }
+                    }
+
                     if ( !bRebuildStaticMesh )
                     {
                         // If geometry has not changed.
@@ -5027,31 +6557,71 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         }
                     }
 
+                    // Displayed meshes are never modified, the part is built into another mesh which replaces the
+                    // previous one once the cook is done. The previous mesh still provides the raw meshes of parts
+                    // whose geometry has not changed.
+                    UStaticMesh * PreviousStaticMesh = ( SourceModelIdx > 0 ) ? LODBasePreviousStaticMesh : nullptr;
+                    if ( SourceModelIdx == 0 && FoundStaticMesh && *FoundStaticMesh )
+                    {
+                        PreviousStaticMesh = *FoundStaticMesh;
+                        FoundStaticMesh = nullptr;
+
+                        // The mesh this part displayed before the previous cook is kept as its back buffer, it is
+                        // rebuilt in place instead of creating a new mesh and package on every cook.
+                        UStaticMesh * const * FoundBackBuffer =
+                            HoudiniAssetComponent->StaticMeshBackBuffers.Find( HoudiniGeoPartObject );
+                        if ( !bShareStaticMesh && !bMergeStaticMesh && FoundBackBuffer && *FoundBackBuffer
+                            && !( *FoundBackBuffer )->IsPendingKill() && !DisplayedStaticMeshes.Contains( *FoundBackBuffer ) )
+                        {
+                            FoundStaticMesh = FoundBackBuffer;
+                        }
+                    }
+
                     // If static mesh was not located, we need to create one.
                     bool bStaticMeshCreated = false;
                     if ( !FoundStaticMesh || *FoundStaticMesh == nullptr )
                     {
                         MeshGuid.Invalidate();
 
-                        UPackage * MeshPackage = FHoudiniEngineUtils::BakeCreateStaticMeshPackageForComponent(
-                            HoudiniAssetComponent, HoudiniGeoPartObject, MeshName, MeshGuid, FHoudiniEngineUtils::EBakeMode::Intermediate );
-                        if( !MeshPackage )
-                            continue;
+                        if ( bMergeStaticMesh && MergeScratchStaticMesh )
+                        {
+                            // Parts which end up merged give their mesh back, the next one is read into it.
+                            StaticMesh = MergeScratchStaticMesh;
+                            MergeScratchStaticMesh = nullptr;
+                        }
+                        else if ( HoudiniRuntimeSettings->bCreateTransientPreviewMeshes || bShareStaticMesh || bMergeStaticMesh )
+                        {
+                            // Preview meshes live in the transient package, they are moved into the package of
+                            // the component when it is saved (see UHoudiniAssetComponent::PreSave). Meshes which may be
+                            // shared also start transient, until we know whether they duplicate an existing one.
+                            MeshName = HoudiniAssetComponent->GetBakingBaseName( HoudiniGeoPartObject );
+                            StaticMesh = NewObject< UStaticMesh >(
+                                GetTransientPackage(),
+                                MakeUniqueObjectName( GetTransientPackage(), UStaticMesh::StaticClass(), FName( *MeshName ) ),
+                                RF_Transactional );
+                        }
+                        else
+                        {
+                            UPackage * MeshPackage = FHoudiniEngineUtils::BakeCreateStaticMeshPackageForComponent(
+                                HoudiniAssetComponent, HoudiniGeoPartObject, MeshName, MeshGuid, FHoudiniEngineUtils::EBakeMode::Intermediate );
+                            if( !MeshPackage )
+                                continue;
 
-                        StaticMesh = NewObject< UStaticMesh >(
-                            MeshPackage, FName( *MeshName ),
-                            RF_Transactional );
+                            StaticMesh = NewObject< UStaticMesh >(
+                                MeshPackage, FName( *MeshName ),
+                                RF_Transactional );
 
-                        // Add meta information to this package.
-                        FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
-                            MeshPackage, MeshPackage,
-                            HAPI_UNREAL_PACKAGE_META_GENERATED_OBJECT, TEXT( "true" ) );
-                        FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
-                            MeshPackage, MeshPackage,
-                            HAPI_UNREAL_PACKAGE_META_GENERATED_NAME, *MeshName );
+                            // Add meta information to this package.
+                            FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
+                                MeshPackage, MeshPackage,
+                                HAPI_UNREAL_PACKAGE_META_GENERATED_OBJECT, TEXT( "true" ) );
+                            FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
+                                MeshPackage, MeshPackage,
+                                HAPI_UNREAL_PACKAGE_META_GENERATED_NAME, *MeshName );
 
-                        // Notify system that new asset has been created.
-                        FAssetRegistryModule::AssetCreated( StaticMesh );
+                            // Notify system that new asset has been created.
+                            FAssetRegistryModule::AssetCreated( StaticMesh );
+                        }
 
                         bStaticMeshCreated = true;
                     }                    
@@ -5062,23 +6632,22 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     }
 
                     // Create new source model for current static mesh.
-                    if ( !StaticMesh->SourceModels.Num() )
+                    while ( StaticMesh->SourceModels.Num() <= SourceModelIdx )
                         new ( StaticMesh->SourceModels ) FStaticMeshSourceModel();
 
                     // Grab current source model.
-                    FStaticMeshSourceModel * SrcModel = &StaticMesh->SourceModels[ 0 ];
+                    FStaticMeshSourceModel * SrcModel = &StaticMesh->SourceModels[ SourceModelIdx ];
 
-                    // Load existing raw model. This will be empty as we are constructing a new mesh.
-                    FRawMesh RawMesh;
+                    // Reset the raw model, keeping the allocations made by previous splits.
+                    FHoudiniEngineUtils::ResetRawMesh( RawMesh );
 
                     // Compute number of faces.
                     int32 FaceCount = SplitGroupFaceIndices.Num();
 
                     // Reset Face materials.
-                    FaceMaterials.Empty();
+                    FaceMaterials.Reset();
 
                     // Attributes we are interested in.
-                    HAPI_AttributeInfo AttribInfoPositions{};
                     HAPI_AttributeInfo AttribLightmapResolution{};
                     HAPI_AttributeInfo AttribFaceMaterials{};
                     HAPI_AttributeInfo AttribInfoColors{};
@@ -5090,12 +6659,11 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     if ( bRebuildStaticMesh )
                     {
                         if ( !bAlreadyCalledGetPositions )
-
                         {
-                            // Retrieve position data.
-                            if ( !FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                                AssetId, ObjectInfo.id, GeoInfo.id,
-                                PartInfo.id, HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, Positions ) )
+                            // Retrieve position data, straight into the raw mesh.
+                            if ( !FHoudiniEngineUtils::HapiGetPointPositions(
+                                AssetId, ObjectInfo.id, GeoInfo.id, PartInfo.id,
+                                GeneratedGeometryScaleFactor, ImportAxis == HRSAI_Unreal, RawMesh.VertexPositions ) )
                             {
                                 // Error retrieving positions.
                                 HOUDINI_LOG_MESSAGE(
@@ -5110,11 +6678,22 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                             }
                         }
 
-                        // Get lightmap resolution (if present).
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
-                            AssetId, ObjectInfo.id, GeoInfo.id,
-                            PartInfo.id, MarshallingAttributeNameLightmapResolution.c_str(),
-                            AttribLightmapResolution, LightMapResolutions );
+                        // Get lightmap resolution (if present). Only the first value is used, so only that one is read.
+                        LightMapResolutions.SetNumUninitialized( 0 );
+                        if ( HoudiniGetAttributeInfo(
+                                AssetId, ObjectInfo.id, GeoInfo.id, PartInfo.id,
+                                MarshallingAttributeNameLightmapResolution.c_str(), 1, AttribLightmapResolution ) &&
+                            AttribLightmapResolution.count > 0 )
+                        {
+                            LightMapResolutions.SetNumUninitialized( 1 );
+                            if ( FHoudiniApi::GetAttributeIntData(
+                                FHoudiniEngine::Get().GetSession(), AssetId, ObjectInfo.id, GeoInfo.id, PartInfo.id,
+                                MarshallingAttributeNameLightmapResolution.c_str(), &AttribLightmapResolution,
+                                LightMapResolutions.GetData(), 0, 1 ) != HAPI_RESULT_SUCCESS )
+                            {
+                                LightMapResolutions.SetNumUninitialized( 0 );
+                            }
+                        }
 
                         // Get name of attribute used for marshalling materials.
                         {
@@ -5126,7 +6705,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                             // If material attribute was not found, check fallback compatibility attribute.
                             if ( !AttribFaceMaterials.exists )
                             {
-                                FaceMaterials.Empty();
+                                FaceMaterials.Reset();
                                 FHoudiniEngineUtils::HapiGetAttributeDataAsString(
                                     AssetId, ObjectInfo.id, GeoInfo.id,
                                     PartInfo.id, MarshallingAttributeNameMaterialFallback.c_str(),
@@ -5138,29 +6717,19 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 HOUDINI_LOG_WARNING( TEXT( "Static Mesh [%d %s], Geo [%d], Part [%d %s]: unreal_material must be a primitive or detail attribute, ignoring attribute." ),
                                     ObjectInfo.nodeId, *ObjectName, GeoIdx, PartIdx, *PartName);
                                 AttribFaceMaterials.exists = false;
-                                FaceMaterials.Empty();
+                                FaceMaterials.Reset();
                             }
                         }
 
-                        // Retrieve color data.
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                            AssetId, ObjectInfo.id, GeoInfo.id,
-                            PartInfo.id, HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, Colors );
-
-                        // Retrieve alpha data.
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                            AssetId, ObjectInfo.id, GeoInfo.id,
-                            PartInfo.id, HAPI_UNREAL_ATTRIB_ALPHA, AttribInfoAlpha, Alphas );
-
-                        // See if we need to transfer color point attributes to vertex attributes.
-                        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                            SplitGroupVertexList,
-                            AttribInfoColors, Colors );
+                        // Retrieve color data, per wedge.
+                        FHoudiniEngineUtils::HapiGetVertexAttributeDataAsFloat(
+                            AssetId, ObjectInfo.id, GeoInfo.id, PartInfo.id, HAPI_UNREAL_ATTRIB_COLOR,
+                            SplitGroupVertexList, AttribInfoColors, Colors );
 
-                        // See if we need to transfer alpha point attributes to vertex attributes.
-                        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                            SplitGroupVertexList,
-                            AttribInfoAlpha, Alphas );
+                        // Retrieve alpha data, per wedge.
+                        FHoudiniEngineUtils::HapiGetVertexAttributeDataAsFloat(
+                            AssetId, ObjectInfo.id, GeoInfo.id, PartInfo.id, HAPI_UNREAL_ATTRIB_ALPHA,
+                            SplitGroupVertexList, AttribInfoAlpha, Alphas );
 
                         // No need to read the normals if we'll recompute them after
                         bool bReadNormals = HoudiniRuntimeSettings->RecomputeNormalsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;
@@ -5168,20 +6737,15 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         // Retrieve normal data.
                         if ( bReadNormals )
                         {
-                            FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                                AssetId, ObjectInfo.id, GeoInfo.id,
-                                PartInfo.id, HAPI_UNREAL_ATTRIB_NORMAL, AttribInfoNormals, Normals );
-
-                            // See if we need to transfer normal point attributes to vertex attributes.
-                            FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+                            FHoudiniEngineUtils::HapiGetVertexAttributeDataAsFloat(
+                                AssetId, ObjectInfo.id, GeoInfo.id, PartInfo.id, HAPI_UNREAL_ATTRIB_NORMAL,
                                 SplitGroupVertexList, AttribInfoNormals, Normals );
                         }
 
-                        // Retrieve face smoothing data.
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
-                            AssetId, ObjectInfo.id, GeoInfo.id,
-                            PartInfo.id, MarshallingAttributeNameFaceSmoothingMask.c_str(),
-                            AttribInfoFaceSmoothingMasks, FaceSmoothingMasks );
+                        // Retrieve face smoothing data, straight into the raw mesh.
+                        FHoudiniEngineUtils::HapiGetFaceAttributeDataAsInteger(
+                            AssetId, ObjectInfo.id, GeoInfo.id, PartInfo.id, MarshallingAttributeNameFaceSmoothingMask.c_str(),
+                            SplitGroupVertexList, AttribInfoFaceSmoothingMasks, RawMesh.FaceSmoothingMasks, 1 );
 
                         // The second UV set should be called uv2, but we will still check if need to look for a uv1 set.
                         // If uv1 exists, we'll look for uv, uv1, uv2 etc.. if not we'll look for uv, uv2, uv3 etc..
@@ -5196,35 +6760,15 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 UVAttributeName += std::to_string( bUV1Exists ? TexCoordIdx : TexCoordIdx + 1 );
 
                             const char * UVAttributeNameString = UVAttributeName.c_str();
-                            FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                            FHoudiniEngineUtils::HapiGetVertexAttributeDataAsFloat(
                                 AssetId, ObjectInfo.id, GeoInfo.id, PartInfo.id, UVAttributeNameString,
-                                AttribInfoUVs[ TexCoordIdx ], TextureCoordinates[ TexCoordIdx ], 2 );
-
-                            // See if we need to transfer uv point attributes to vertex attributes.
-                            FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                                SplitGroupVertexList, AttribInfoUVs[ TexCoordIdx ], TextureCoordinates[ TexCoordIdx ] );
+                                SplitGroupVertexList, AttribInfoUVs[ TexCoordIdx ], TextureCoordinates[ TexCoordIdx ], 2 );
                         }
 
                         // We can transfer attributes to raw mesh.
 
-                        // Set face smoothing masks.
-                        {
-                            RawMesh.FaceSmoothingMasks.SetNumZeroed( FaceCount );
-
-                            if ( FaceSmoothingMasks.Num() )
-                            {
-                                int32 ValidFaceIdx = 0;
-                                for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx += 3 )
-                                {
-                                    int32 WedgeCheck = SplitGroupVertexList[ VertexIdx + 0 ];
-                                    if ( WedgeCheck == -1 )
-                                        continue;
-
-                                    RawMesh.FaceSmoothingMasks[ ValidFaceIdx ] = FaceSmoothingMasks[ VertexIdx / 3 ];
-                                    ValidFaceIdx++;
-                                }
-                            }
-                        }
+                        // Face smoothing masks were read per face, faces without one are not smoothed.
+                        RawMesh.FaceSmoothingMasks.SetNumZeroed( FaceCount );
 
                         // Transfer UVs.
                         int32 UVChannelCount = 0;
@@ -5444,9 +6988,11 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                             ValidVertexId += 3;
                         }
 
-                        // Transfer vertex positions.
-                        int32 VertexPositionsCount = Positions.Num() / 3;
-                        RawMesh.VertexPositions.SetNumZeroed( VertexPositionsCount );
+                        // Transfer vertex positions, unless they have already been read into the raw mesh.
+                        int32 VertexPositionsCount = bAlreadyCalledGetPositions ? Positions.Num() / 3 : 0;
+                        if ( bAlreadyCalledGetPositions )
+                            RawMesh.VertexPositions.SetNumZeroed( VertexPositionsCount );
+
                         for ( int32 VertexPositionIdx = 0; VertexPositionIdx < VertexPositionsCount; ++VertexPositionIdx )
                         {
                             FVector VertexPosition;
@@ -5487,9 +7033,17 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     {
                         // Otherwise we'll just load old data into Raw mesh and reuse it.
                         FRawMeshBulkData * InRawMeshBulkData = SrcModel->RawMeshBulkData;
+                        if ( PreviousStaticMesh && PreviousStaticMesh->SourceModels.IsValidIndex( SourceModelIdx ) )
+                            InRawMeshBulkData = PreviousStaticMesh->SourceModels[ SourceModelIdx ].RawMeshBulkData;
+
                         InRawMeshBulkData->LoadRawMesh( RawMesh );
                     }
 
+                    // Imported LODs share the material slots of the main geometry's mesh.
+                    TArray< FStaticMaterial > LODBaseStaticMaterials;
+                    if ( SourceModelIdx > 0 )
+                        LODBaseStaticMaterials = StaticMesh->StaticMaterials;
+
                     // Process material replacements first.
                     bool bMissingReplacement = false;
                     bool bMaterialsReplaced = false;
@@ -5730,6 +7284,120 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         }
                     }
 
+                    if ( SourceModelIdx > 0 )
+                    {
+                        // Remap this LOD's materials onto the main geometry's material slots, adding missing ones.
+                        TArray< int32 > LODMaterialRemap;
+                        for ( int32 MaterialIdx = 0; MaterialIdx < StaticMesh->StaticMaterials.Num(); ++MaterialIdx )
+                        {
+                            UMaterialInterface * LODMaterial = StaticMesh->StaticMaterials[ MaterialIdx ].MaterialInterface;
+
+                            int32 BaseMaterialIdx = INDEX_NONE;
+                            for ( int32 BaseIdx = 0; BaseIdx < LODBaseStaticMaterials.Num(); ++BaseIdx )
+                            {
+                                if ( LODBaseStaticMaterials[ BaseIdx ].MaterialInterface == LODMaterial )
+                                {
+                                    BaseMaterialIdx = BaseIdx;
+                                    break;
+                                }
+                            }
+
+                            if ( BaseMaterialIdx == INDEX_NONE )
+                                BaseMaterialIdx = LODBaseStaticMaterials.Add( StaticMesh->StaticMaterials[ MaterialIdx ] );
+
+                            LODMaterialRemap.Add( BaseMaterialIdx );
+                        }
+
+                        for ( int32 FaceIdx = 0; FaceIdx < RawMesh.FaceMaterialIndices.Num(); ++FaceIdx )
+                        {
+                            int32 FaceMaterialIdx = RawMesh.FaceMaterialIndices[ FaceIdx ];
+                            RawMesh.FaceMaterialIndices[ FaceIdx ] =
+                                LODMaterialRemap.IsValidIndex( FaceMaterialIdx ) ? LODMaterialRemap[ FaceMaterialIdx ] : 0;
+                        }
+
+                        StaticMesh->StaticMaterials = LODBaseStaticMaterials;
+                    }
+
+                    if ( bMergeStaticMesh && StaticMesh->StaticMaterials.Num() == 1 )
+                    {
+                        // Look for merged parts with the same transform, material and streams.
+                        const FHoudiniGeoPartObject * MergedGeoPartObject = nullptr;
+                        for ( TMap< FHoudiniGeoPartObject, FRawMesh >::TConstIterator Iter( MergedRawMeshes ); Iter; ++Iter )
+                        {
+                            const FHoudiniGeoPartObject & RepresentativeGeoPartObject = Iter.Key();
+                            if ( RepresentativeGeoPartObject.TransformMatrix.Equals( HoudiniGeoPartObject.TransformMatrix ) &&
+                                MergedStaticMaterials[ RepresentativeGeoPartObject ].MaterialInterface == StaticMesh->StaticMaterials[ 0 ].MaterialInterface &&
+                                MergedLightMapCoordinateIndices[ RepresentativeGeoPartObject ] == StaticMesh->LightMapCoordinateIndex &&
+                                FHoudiniEngineUtils::HaveSameRawMeshStreams( Iter.Value(), RawMesh ) )
+                            {
+                                MergedGeoPartObject = &RepresentativeGeoPartObject;
+                                break;
+                            }
+                        }
+
+                        if ( MergedGeoPartObject )
+                        {
+                            FHoudiniEngineUtils::AppendRawMesh( MergedRawMeshes[ *MergedGeoPartObject ], RawMesh );
+                        }
+                        else
+                        {
+                            // This part represents the parts merged with it, their combined mesh will be stored under it.
+                            MergedRawMeshes.Add( HoudiniGeoPartObject, RawMesh );
+                            MergedStaticMaterials.Add( HoudiniGeoPartObject, StaticMesh->StaticMaterials[ 0 ] );
+                            MergedLightMapCoordinateIndices.Add( HoudiniGeoPartObject, StaticMesh->LightMapCoordinateIndex );
+                        }
+
+                        // The part's own mesh has not been built, it is used for the next part which may be merged.
+                        MergeScratchStaticMesh = StaticMesh;
+                        continue;
+                    }
+                    else if ( bMergeStaticMesh && !HoudiniRuntimeSettings->bCreateTransientPreviewMeshes )
+                    {
+                        // Parts with several materials are not merged, this mesh is kept and can now get its package.
+                        FHoudiniEngineUtils::CreatePackageForTransientStaticMesh( HoudiniAssetComponent, HoudiniGeoPartObject, StaticMesh );
+                    }
+
+                    if ( bShareStaticMesh )
+                    {
+                        // Parts with the same content, up to a translation, share the first mesh built for it. Positions
+                        // are quantized in the hash, so a match is confirmed on the positions themselves.
+                        FSHAHash ContentHash = FHoudiniEngineUtils::ComputeStaticMeshContentHash( RawMesh, StaticMesh );
+                        FVector ContentOrigin = RawMesh.VertexPositions.Num() > 0 ? RawMesh.VertexPositions[ 0 ] : FVector::ZeroVector;
+
+                        UStaticMesh * const * FoundSharedStaticMesh = SharedStaticMeshes.Find( ContentHash );
+                        if ( FoundSharedStaticMesh && FHoudiniEngineUtils::HaveSameRelativePositions(
+                            RawMesh.VertexPositions, GetSharedStaticMeshPositions( *FoundSharedStaticMesh ) ) )
+                        {
+                            // This mesh duplicates a shared one, it has not been built yet and can be discarded.
+                            if ( bStaticMeshCreated )
+                                StaticMesh->MarkPendingKill();
+
+                            StaticMesh = *FoundSharedStaticMesh;
+
+                            // Offset the part so that the shared geometry ends up where its own would have been.
+                            FVector ContentOffset = ContentOrigin - SharedStaticMeshOrigins[ StaticMesh ];
+                            HoudiniGeoPartObject.TransformMatrix = FTransform( ContentOffset ) * HoudiniGeoPartObject.TransformMatrix;
+
+                            SharedGeoPartHashes.Add( HoudiniGeoPartObject, ContentHash );
+                            SharedGeoPartOrigins.Add( HoudiniGeoPartObject, ContentOrigin );
+                            StaticMeshesOut.Add( HoudiniGeoPartObject, StaticMesh );
+                            continue;
+                        }
+
+                        // A part whose hash matches different content keeps a mesh of its own, which is not shared.
+                        if ( !FoundSharedStaticMesh )
+                        {
+                            SharedStaticMeshes.Add( ContentHash, StaticMesh );
+                            SharedStaticMeshOrigins.Add( StaticMesh, ContentOrigin );
+                            SharedGeoPartHashes.Add( HoudiniGeoPartObject, ContentHash );
+                            SharedGeoPartOrigins.Add( HoudiniGeoPartObject, ContentOrigin );
+                        }
+
+                        // This mesh is kept, it can now get its package.
+                        if ( bStaticMeshCreated && !HoudiniRuntimeSettings->bCreateTransientPreviewMeshes )
+                            FHoudiniEngineUtils::CreatePackageForTransientStaticMesh( HoudiniAssetComponent, HoudiniGeoPartObject, StaticMesh );
+                    }
+
                     // Some mesh generation settings.
                     HoudiniRuntimeSettings->SetMeshBuildSettings( SrcModel->BuildSettings, RawMesh );
 
@@ -5752,24 +7420,42 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         }
                     }
 
+                    // Meshes built while cooking interactively skip the costly build steps until the asset is idle.
+                    if ( HoudiniAssetComponent->bGeneratedUsePreviewMeshBuild )
+                    {
+                        HoudiniRuntimeSettings->SetPreviewMeshBuildSettings( SrcModel->BuildSettings );
+                        PreviewBuiltStaticMeshes.Add( StaticMesh );
+                    }
+
                     // Store the new raw mesh.
                     SrcModel->RawMeshBulkData->SaveRawMesh( RawMesh );
 
-                    while( StaticMesh->SourceModels.Num() < NumLODs )
-                        new ( StaticMesh->SourceModels ) FStaticMeshSourceModel();
+                    // Imported LODs are done, the main geometry's mesh will be built after the last one.
+                    if ( SourceModelIdx > 0 )
+                        continue;
 
-                    for ( int32 ModelLODIndex = 0; ModelLODIndex < NumLODs; ++ModelLODIndex )
+                    if ( !bDeferStaticMeshBuild )
                     {
-                        StaticMesh->SourceModels[ ModelLODIndex ].ReductionSettings =
-                            LODGroup.GetDefaultSettings( ModelLODIndex );
+                        while( StaticMesh->SourceModels.Num() < NumLODs )
+                            new ( StaticMesh->SourceModels ) FStaticMeshSourceModel();
 
-                        for ( int32 MaterialIndex = 0; MaterialIndex < StaticMesh->StaticMaterials.Num(); ++MaterialIndex )
+                        for ( int32 ModelLODIndex = 0; ModelLODIndex < NumLODs; ++ModelLODIndex )
                         {
-                            FMeshSectionInfo Info = StaticMesh->SectionInfoMap.Get( ModelLODIndex, MaterialIndex );
-                            Info.MaterialIndex = MaterialIndex;
-                            Info.bEnableCollision = true;
-                            Info.bCastShadow = true;
-                            StaticMesh->SectionInfoMap.Set( ModelLODIndex, MaterialIndex, Info );
+                            StaticMesh->SourceModels[ ModelLODIndex ].ReductionSettings =
+                                LODGroup.GetDefaultSettings( ModelLODIndex );
+
+                            // Discard raw meshes left over from previously imported LODs, these LODs are generated.
+                            if ( ModelLODIndex > 0 && !StaticMesh->SourceModels[ ModelLODIndex ].RawMeshBulkData->IsEmpty() )
+                                StaticMesh->SourceModels[ ModelLODIndex ].RawMeshBulkData->Empty();
+
+                            for ( int32 MaterialIndex = 0; MaterialIndex < StaticMesh->StaticMaterials.Num(); ++MaterialIndex )
+                            {
+                                FMeshSectionInfo Info = StaticMesh->SectionInfoMap.Get( ModelLODIndex, MaterialIndex );
+                                Info.MaterialIndex = MaterialIndex;
+                                Info.bEnableCollision = true;
+                                Info.bCastShadow = true;
+                                StaticMesh->SectionInfoMap.Set( ModelLODIndex, MaterialIndex, Info );
+                            }
                         }
                     }
 
@@ -5801,21 +7487,30 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         BodySetup->CollisionTraceFlag = ECollisionTraceFlag::CTF_UseComplexAsSimple;
                     }
 
-                    // Free any RHI resources.
-                    StaticMesh->PreEditChange( nullptr );
+                    if ( bDeferStaticMeshBuild )
+                    {
+                        // Following LOD splits will be stored in this mesh before building it.
+                        LODBaseStaticMesh = StaticMesh;
+                        LODBasePreviousStaticMesh = PreviousStaticMesh;
+                    }
+                    else
+                    {
+                        // Free any RHI resources.
+                        StaticMesh->PreEditChange( nullptr );
 
-                    FHoudiniScopedGlobalSilence ScopedGlobalSilence;
+                        FHoudiniScopedGlobalSilence ScopedGlobalSilence;
 
-                    TArray<FText> BuildErrors;
-                    StaticMesh->Build( true, &BuildErrors );
+                        TArray<FText> BuildErrors;
+                        StaticMesh->Build( true, &BuildErrors );
 
-                    for ( int32 BuildErrorIdx = 0; BuildErrorIdx < BuildErrors.Num(); ++BuildErrorIdx )
-                    {
-                        const FText& TextError = BuildErrors[BuildErrorIdx];
-                        HOUDINI_LOG_MESSAGE(
-                            TEXT( "Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d] build error " )
-                            TEXT( "- %s." ),
-                            ObjectIdx, *ObjectName, GeoIdx, PartIdx, *PartName, SplitId, *( TextError.ToString() ) );
+                        for ( int32 BuildErrorIdx = 0; BuildErrorIdx < BuildErrors.Num(); ++BuildErrorIdx )
+                        {
+                            const FText& TextError = BuildErrors[BuildErrorIdx];
+                            HOUDINI_LOG_MESSAGE(
+                                TEXT( "Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d] build error " )
+                                TEXT( "- %s." ),
+                                ObjectIdx, *ObjectName, GeoIdx, PartIdx, *PartName, SplitId, *( TextError.ToString() ) );
+                        }
                     }
 
                     // Do we want to add simple collisions ?
@@ -5913,6 +7608,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                             StaticMesh, HoudiniGeoPartObject, AggregateCollisionGeo ) )
                         {
                             bHasAggregateGeometryCollision = false;
+                            CollisionChangedStaticMeshes.Add( StaticMesh );
                         }
                     }
 
@@ -5925,6 +7621,49 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                 } // end for SplitId
 
+                // All imported LODs have been stored, we can now build the main geometry's mesh.
+                if ( LODBaseStaticMesh )
+                {
+                    int32 ImportedLODCount = ImportedLODSplitNames.Num() + 1;
+                    if ( LODBaseStaticMesh->SourceModels.Num() > ImportedLODCount )
+                    {
+                        LODBaseStaticMesh->SourceModels.RemoveAt(
+                            ImportedLODCount, LODBaseStaticMesh->SourceModels.Num() - ImportedLODCount );
+                    }
+
+                    for ( int32 ModelLODIndex = 0; ModelLODIndex < LODBaseStaticMesh->SourceModels.Num(); ++ModelLODIndex )
+                    {
+                        // Imported LODs are used as is, no automatic reduction.
+                        LODBaseStaticMesh->SourceModels[ ModelLODIndex ].ReductionSettings = FMeshReductionSettings();
+
+                        for ( int32 MaterialIndex = 0; MaterialIndex < LODBaseStaticMesh->StaticMaterials.Num(); ++MaterialIndex )
+                        {
+                            FMeshSectionInfo Info = LODBaseStaticMesh->SectionInfoMap.Get( ModelLODIndex, MaterialIndex );
+                            Info.MaterialIndex = MaterialIndex;
+                            Info.bEnableCollision = true;
+                            Info.bCastShadow = true;
+                            LODBaseStaticMesh->SectionInfoMap.Set( ModelLODIndex, MaterialIndex, Info );
+                        }
+                    }
+
+                    // Free any RHI resources.
+                    LODBaseStaticMesh->PreEditChange( nullptr );
+
+                    FHoudiniScopedGlobalSilence ScopedGlobalSilence;
+
+                    TArray<FText> BuildErrors;
+                    LODBaseStaticMesh->Build( true, &BuildErrors );
+
+                    for ( int32 BuildErrorIdx = 0; BuildErrorIdx < BuildErrors.Num(); ++BuildErrorIdx )
+                    {
+                        const FText& TextError = BuildErrors[ BuildErrorIdx ];
+                        HOUDINI_LOG_MESSAGE(
+                            TEXT( "Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], %d LODs build error " )
+                            TEXT( "- %s." ),
+                            ObjectIdx, *ObjectName, GeoIdx, PartIdx, *PartName, ImportedLODCount, *( TextError.ToString() ) );
+                    }
+                }
+
             } // end for PartId
 
             // We need to add the remaining UCX/UBX/Collisions here
@@ -5970,10 +7709,15 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 }
 
                 // Add the aggregate collision geo to the static mesh
-                if ( AddAggregateCollisionGeometryToStaticMesh(
-                StaticMesh, *CollisionHoudiniGeoPartObject, AggregateCollisionGeo ) )
+                if ( CollisionStaticMesh && CollisionHoudiniGeoPartObject )
                 {
-                    bHasAggregateGeometryCollision = false;
+                    FlushRenderingIfDisplayed( CollisionStaticMesh );
+                    if ( AddAggregateCollisionGeometryToStaticMesh(
+                        CollisionStaticMesh, *CollisionHoudiniGeoPartObject, AggregateCollisionGeo ) )
+                    {
+                        bHasAggregateGeometryCollision = false;
+                        CollisionChangedStaticMeshes.Add( CollisionStaticMesh );
+                    }
                 }
             }
 
@@ -5989,71 +7733,214 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 {
                     FHoudiniGeoPartObject * HoudiniGeoPartObject = &(Iter.Key());
 
-                    if ( ( HoudiniGeoPartObject->ObjectId != ObjectInfo.nodeId ) && ( HoudiniGeoPartObject->GeoId != GeoInfo.nodeId ) )
-                    {
-                        // If we haven't find a mesh for the socket yet, we might as well use this one but
-                        // we will keep searching for a "better" candidate
-                        if ( !SocketStaticMesh )
-                        {
-                            SocketStaticMesh = Iter.Value();
-                            SocketHoudiniGeoPartObject = HoudiniGeoPartObject;
-                        }
+                    if ( ( HoudiniGeoPartObject->ObjectId != ObjectInfo.nodeId ) && ( HoudiniGeoPartObject->GeoId != GeoInfo.nodeId ) )
+                    {
+                        // If we haven't find a mesh for the socket yet, we might as well use this one but
+                        // we will keep searching for a "better" candidate
+                        if ( !SocketStaticMesh )
+                        {
+                            SocketStaticMesh = Iter.Value();
+                            SocketHoudiniGeoPartObject = HoudiniGeoPartObject;
+                        }
+
+                        continue;
+                    }
+
+                    if ( HoudiniGeoPartObject->IsCollidable() )
+                    {
+                        // This object has the same geo/node id, but won't be visible,
+                        // so we'll keep looking for a "better" one
+                        SocketStaticMesh = Iter.Value();
+                        SocketHoudiniGeoPartObject = HoudiniGeoPartObject;
+                        continue;
+                    }
+
+                    // This mesh is from the same geo and is visible, we'll add the socket to it..
+                    SocketStaticMesh = Iter.Value();
+                    SocketHoudiniGeoPartObject = HoudiniGeoPartObject;
+                    break;
+                }
+
+                // Add socket to the mesh if we found a suitable one
+                if ( SocketStaticMesh )
+                    AddMeshSocketsToStaticMesh( SocketStaticMesh, *SocketHoudiniGeoPartObject, AllSockets, AllSocketsNames, AllSocketsActors );
+            }
+
+        } // end for GeoId
+
+    } // end for ObjectId
+
+
+    // Build the combined meshes of merged parts. Like other rebuilt meshes, they replace the displayed ones once
+    // the cook is done.
+    TMap< UStaticMesh *, FSHAHash > MergedStaticMeshHashes;
+    for ( TMap< FHoudiniGeoPartObject, FRawMesh >::TIterator Iter( MergedRawMeshes ); Iter; ++Iter )
+    {
+        const FHoudiniGeoPartObject & HoudiniGeoPartObject = Iter.Key();
+        FRawMesh & MergedRawMesh = Iter.Value();
+
+        // Content of the merged parts. Combined meshes are not shared, so their positions are hashed exactly.
+        FSHAHash ContentHash;
+        {
+            FSHA1 HashState;
+
+            const FSHAHash RawMeshHash = FHoudiniEngineUtils::ComputeStaticMeshContentHash( MergedRawMesh, nullptr, false );
+            HashState.Update( RawMeshHash.Hash, sizeof( RawMeshHash.Hash ) );
+
+            const int32 LightMapCoordinateIndex = MergedLightMapCoordinateIndices[ HoudiniGeoPartObject ];
+            HashState.Update( (const uint8 *) &LightMapCoordinateIndex, sizeof( int32 ) );
+
+            UMaterialInterface * MaterialInterface = MergedStaticMaterials[ HoudiniGeoPartObject ].MaterialInterface;
+            FString MaterialPathName = MaterialInterface ? MaterialInterface->GetPathName() : FString();
+            HashState.UpdateWithString( *MaterialPathName, MaterialPathName.Len() );
+
+            HashState.Final();
+            HashState.GetHash( ContentHash.Hash );
+        }
+
+        // The combined mesh of the previous cook is reused if the merged parts have not changed.
+        UStaticMesh * const * FoundStaticMesh = StaticMeshesIn.Find( HoudiniGeoPartObject );
+        const FSHAHash * FoundContentHash = ( FoundStaticMesh && *FoundStaticMesh ) ?
+            HoudiniAssetComponent->MergedStaticMeshHashes.Find( *FoundStaticMesh ) : nullptr;
+
+        if ( FoundContentHash && *FoundContentHash == ContentHash && !HoudiniAssetComponent->bManualRecookRequested &&
+            HoudiniAssetComponent->CheckGlobalSettingScaleFactors() )
+        {
+            MergedStaticMeshHashes.Add( *FoundStaticMesh, ContentHash );
+            StaticMeshesOut.Add( HoudiniGeoPartObject, *FoundStaticMesh );
+            continue;
+        }
+
+        MeshName = HoudiniAssetComponent->GetBakingBaseName( HoudiniGeoPartObject );
+        UStaticMesh * StaticMesh = NewObject< UStaticMesh >(
+            GetTransientPackage(),
+            MakeUniqueObjectName( GetTransientPackage(), UStaticMesh::StaticClass(), FName( *MeshName ) ),
+            RF_Transactional );
+
+        if ( !HoudiniRuntimeSettings->bCreateTransientPreviewMeshes )
+            FHoudiniEngineUtils::CreatePackageForTransientStaticMesh( HoudiniAssetComponent, HoudiniGeoPartObject, StaticMesh );
+
+        StaticMesh->StaticMaterials.Empty();
+        StaticMesh->StaticMaterials.Add( MergedStaticMaterials[ HoudiniGeoPartObject ] );
+        StaticMesh->LightMapCoordinateIndex = MergedLightMapCoordinateIndices[ HoudiniGeoPartObject ];
+
+        while ( StaticMesh->SourceModels.Num() < NumLODs )
+            new ( StaticMesh->SourceModels ) FStaticMeshSourceModel();
+
+        for ( int32 ModelLODIndex = 0; ModelLODIndex < NumLODs; ++ModelLODIndex )
+        {
+            StaticMesh->SourceModels[ ModelLODIndex ].ReductionSettings = LODGroup.GetDefaultSettings( ModelLODIndex );
+
+            if ( ModelLODIndex > 0 && !StaticMesh->SourceModels[ ModelLODIndex ].RawMeshBulkData->IsEmpty() )
+                StaticMesh->SourceModels[ ModelLODIndex ].RawMeshBulkData->Empty();
+
+            FMeshSectionInfo Info = StaticMesh->SectionInfoMap.Get( ModelLODIndex, 0 );
+            Info.MaterialIndex = 0;
+            Info.bEnableCollision = true;
+            Info.bCastShadow = true;
+            StaticMesh->SectionInfoMap.Set( ModelLODIndex, 0, Info );
+        }
+
+        FStaticMeshSourceModel * SrcModel = &StaticMesh->SourceModels[ 0 ];
+        HoudiniRuntimeSettings->SetMeshBuildSettings( SrcModel->BuildSettings, MergedRawMesh );
+        SrcModel->BuildSettings.DistanceFieldResolutionScale = HoudiniAssetComponent->GeneratedDistanceFieldResolutionScale;
 
-                        continue;
-                    }
+        if ( SrcModel->BuildSettings.bGenerateLightmapUVs &&
+            FHoudiniEngineUtils::ContainsInvalidLightmapFaces( MergedRawMesh, StaticMesh->LightMapCoordinateIndex ) )
+        {
+            SrcModel->BuildSettings.bGenerateLightmapUVs = false;
+        }
 
-                    if ( HoudiniGeoPartObject->IsCollidable() )
-                    {
-                        // This object has the same geo/node id, but won't be visible,
-                        // so we'll keep looking for a "better" one
-                        SocketStaticMesh = Iter.Value();
-                        SocketHoudiniGeoPartObject = HoudiniGeoPartObject;
-                        continue;
-                    }
+        if ( HoudiniAssetComponent->bGeneratedUsePreviewMeshBuild )
+        {
+            HoudiniRuntimeSettings->SetPreviewMeshBuildSettings( SrcModel->BuildSettings );
+            PreviewBuiltStaticMeshes.Add( StaticMesh );
+        }
 
-                    // This mesh is from the same geo and is visible, we'll add the socket to it..
-                    SocketStaticMesh = Iter.Value();
-                    SocketHoudiniGeoPartObject = HoudiniGeoPartObject;
-                    break;
-                }
+        SrcModel->RawMeshBulkData->SaveRawMesh( MergedRawMesh );
 
-                // Add socket to the mesh if we found a suitable one
-                if ( SocketStaticMesh )
-                    AddMeshSocketsToStaticMesh( SocketStaticMesh, *SocketHoudiniGeoPartObject, AllSockets, AllSocketsNames, AllSocketsActors );
+        HoudiniAssetComponent->SetStaticMeshGenerationParameters( StaticMesh );
+
+        // Merged parts are never collidable.
+        check( StaticMesh->BodySetup );
+        StaticMesh->BodySetup->RemoveSimpleCollision();
+
+        // Free any RHI resources.
+        StaticMesh->PreEditChange( nullptr );
+
+        {
+            FHoudiniScopedGlobalSilence ScopedGlobalSilence;
+
+            TArray< FText > BuildErrors;
+            StaticMesh->Build( true, &BuildErrors );
+
+            for ( int32 BuildErrorIdx = 0; BuildErrorIdx < BuildErrors.Num(); ++BuildErrorIdx )
+            {
+                HOUDINI_LOG_MESSAGE(
+                    TEXT( "Creating Static Meshes: Merged parts of Object [%d], Geo [%d], Part [%d] build error - %s." ),
+                    HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.GeoId, HoudiniGeoPartObject.PartId,
+                    *( BuildErrors[ BuildErrorIdx ].ToString() ) );
             }
+        }
 
-        } // end for GeoId
+        StaticMesh->MarkPackageDirty();
 
-    } // end for ObjectId
+        MergedStaticMeshHashes.Add( StaticMesh, ContentHash );
+        StaticMeshesOut.Add( HoudiniGeoPartObject, StaticMesh );
+    }
 
+    HoudiniAssetComponent->MergedStaticMeshHashes = MergedStaticMeshHashes;
+
+    if ( MergeScratchStaticMesh )
+        MergeScratchStaticMesh->MarkPendingKill();
 
     // Now that all the meshes are built and their collisions meshes and primitives updated,
-    // we need to update their pre-built navigation collision used by the navmesh
+    // we need to update their pre-built navigation collision used by the navmesh.
     for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( StaticMeshesOut ); Iter; ++Iter )
     {
-        FHoudiniGeoPartObject HoudiniGeoPartObject = Iter.Key();
+        const FHoudiniGeoPartObject & HoudiniGeoPartObject = Iter.Key();
 
         // Only update for collidable objects
-        if ( HoudiniGeoPartObject.IsCollidable() || HoudiniGeoPartObject.IsRenderCollidable() )
-        {
-            StaticMesh = Iter.Value();
-            if ( !StaticMesh )
-                continue;
+        if ( ( HoudiniGeoPartObject.IsCollidable() || HoudiniGeoPartObject.IsRenderCollidable() ) && Iter.Value() )
+            CollisionChangedStaticMeshes.Add( Iter.Value() );
+    }
 
-            UBodySetup * BodySetup = StaticMesh->BodySetup;
-            check(BodySetup);
+    // Remember the content of the shared meshes still in use, so that the next cook can match parts to them.
+    TSet< UStaticMesh * > UsedStaticMeshes;
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( StaticMeshesOut ); Iter; ++Iter )
+        UsedStaticMeshes.Add( Iter.Value() );
 
-            // Unreal caches the Navigation Collision and never updates it for StaticMeshes,
-            // so we need to manually flush and recreate the data to have proper navigation collision
-            if ( StaticMesh->NavCollision )
-            {
-                StaticMesh->NavCollision->CookedFormatData.FlushData();
-                StaticMesh->NavCollision->GatherCollision();
-                StaticMesh->NavCollision->Setup( BodySetup );
-            }
-        }
+    HoudiniAssetComponent->SharedStaticMeshHashes.Empty();
+    HoudiniAssetComponent->SharedStaticMeshOrigins.Empty();
+    for ( TMap< FSHAHash, UStaticMesh * >::TConstIterator Iter( SharedStaticMeshes ); Iter; ++Iter )
+    {
+        UStaticMesh * SharedStaticMesh = Iter.Value();
+        if ( !UsedStaticMeshes.Contains( SharedStaticMesh ) )
+            continue;
+
+        HoudiniAssetComponent->SharedStaticMeshHashes.Add( SharedStaticMesh, Iter.Key() );
+        HoudiniAssetComponent->SharedStaticMeshOrigins.Add( SharedStaticMesh, SharedStaticMeshOrigins[ SharedStaticMesh ] );
     }
 
+    HoudiniAssetComponent->SharedGeoPartHashes = SharedGeoPartHashes;
+    HoudiniAssetComponent->SharedGeoPartOrigins = SharedGeoPartOrigins;
+
+    // This is done for all meshes at once, either now or when the component becomes idle.
+    HoudiniAssetComponent->RefreshCollisionChanges( CollisionChangedStaticMeshes );
+
+    // Meshes built with preview settings get their full build once the component is idle.
+    HoudiniAssetComponent->QueueFullQualityStaticMeshBuilds( PreviewBuiltStaticMeshes );
+
+#if STATS
+    // Scratch containers are released when we return, publish how much they were reused during this cook.
+    UpdateScratchStatistics();
+    SET_MEMORY_STAT( STAT_HoudiniMeshScratchPeakSize, ScratchPeakSize );
+    SET_DWORD_STAT( STAT_HoudiniMeshScratchSplits, ScratchSplitCount );
+    SET_DWORD_STAT( STAT_HoudiniMeshScratchAllocations, ScratchAllocationCount );
+    SET_DWORD_STAT( STAT_HoudiniMeshScratchAllocationsAvoided,
+        ScratchUsedContainerCount > ScratchAllocationCount ? ScratchUsedContainerCount - ScratchAllocationCount : 0 );
+#endif
+
 #endif
 
     return true;
@@ -6110,8 +7997,12 @@ FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
     {
         // Future optimization - see if we can do direct vertex transfer.
 
+        // Re-indexed values are staged on the thread's mem stack, which is released when we return,
+        // instead of allocating a new heap buffer for every attribute of every split.
+        FMemMark MemMark( FMemStack::Get() );
+
         int32 WedgeCount = VertexList.Num();
-        TArray< float > VertexData;
+        TArray< float, TMemStackAllocator<> > VertexData;
         VertexData.SetNumZeroed( WedgeCount * AttribInfo.tupleSize );
 
         int32 LastValidWedgeIdx = 0;
@@ -6175,8 +8066,9 @@ FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
             LastValidWedgeIdx++;
         }
 
-        VertexData.SetNumZeroed( ValidWedgeCount * AttribInfo.tupleSize );
-        Data = VertexData;
+        // Reset keeps the capacity of Data, so the caller's buffer is reused.
+        Data.Reset();
+        Data.Append( VertexData.GetData(), ValidWedgeCount * AttribInfo.tupleSize );
     }
 
     return ValidWedgeCount;
@@ -6240,51 +8132,85 @@ FHoudiniEngineUtils::BakeStaticMesh(
     // Copy materials.
     StaticMesh->StaticMaterials = InStaticMesh->StaticMaterials;
 
-    // Create new source model for current static mesh.
-    if ( !StaticMesh->SourceModels.Num() )
+    // LODs imported from Houdini are stored in the raw meshes of the following source models.
+    bool bHasImportedLODs = false;
+    for ( int32 ModelLODIndex = 1; ModelLODIndex < InStaticMesh->SourceModels.Num(); ++ModelLODIndex )
+    {
+        if ( !InStaticMesh->SourceModels[ ModelLODIndex ].RawMeshBulkData->IsEmpty() )
+        {
+            bHasImportedLODs = true;
+            break;
+        }
+    }
+
+    // Create new source models for current static mesh, imported LODs are copied along with the main geometry.
+    const int32 SourceModelCount = bHasImportedLODs ? InStaticMesh->SourceModels.Num() : 1;
+    while ( StaticMesh->SourceModels.Num() < SourceModelCount )
         new ( StaticMesh->SourceModels ) FStaticMeshSourceModel();
 
-    FStaticMeshSourceModel * SrcModel = &StaticMesh->SourceModels[ 0 ];
-    FRawMeshBulkData * RawMeshBulkData = SrcModel->RawMeshBulkData;
+    for ( int32 ModelLODIndex = 0; ModelLODIndex < SourceModelCount; ++ModelLODIndex )
+    {
+        FStaticMeshSourceModel * SrcModel = &StaticMesh->SourceModels[ ModelLODIndex ];
+        FStaticMeshSourceModel * InSrcModel = &InStaticMesh->SourceModels[ ModelLODIndex ];
 
-    // Load raw data bytes.
-    FRawMesh RawMesh;
-    FStaticMeshSourceModel * InSrcModel = &InStaticMesh->SourceModels[ 0 ];
-    FRawMeshBulkData * InRawMeshBulkData = InSrcModel->RawMeshBulkData;
-    InRawMeshBulkData->LoadRawMesh( RawMesh );
+        // Load raw data bytes.
+        FRawMesh RawMesh;
+        InSrcModel->RawMeshBulkData->LoadRawMesh( RawMesh );
 
-    // Some mesh generation settings.
-    HoudiniRuntimeSettings->SetMeshBuildSettings( SrcModel->BuildSettings, RawMesh );
+        if ( ModelLODIndex > 0 )
+        {
+            // Imported LODs keep the settings they were built with.
+            SrcModel->BuildSettings = InSrcModel->BuildSettings;
+            SrcModel->ReductionSettings = InSrcModel->ReductionSettings;
+            SrcModel->ScreenSize = InSrcModel->ScreenSize;
+            SrcModel->RawMeshBulkData->SaveRawMesh( RawMesh );
+            continue;
+        }
 
-    // Setting the DistanceField resolution
-    SrcModel->BuildSettings.DistanceFieldResolutionScale = HoudiniAssetComponent->GeneratedDistanceFieldResolutionScale;
+        // Some mesh generation settings.
+        HoudiniRuntimeSettings->SetMeshBuildSettings( SrcModel->BuildSettings, RawMesh );
+        SrcModel->ReductionSettings = InSrcModel->ReductionSettings;
+        SrcModel->ScreenSize = InSrcModel->ScreenSize;
 
-    // We need to check light map uv set for correctness. Unreal seems to have occasional issues with
-    // zero UV sets when building lightmaps.
-    if ( SrcModel->BuildSettings.bGenerateLightmapUVs )
-    {
-        // See if we need to disable lightmap generation because of bad UVs.
-        if ( FHoudiniEngineUtils::ContainsInvalidLightmapFaces( RawMesh, StaticMesh->LightMapCoordinateIndex ) )
+        // Setting the DistanceField resolution
+        SrcModel->BuildSettings.DistanceFieldResolutionScale = HoudiniAssetComponent->GeneratedDistanceFieldResolutionScale;
+
+        // We need to check light map uv set for correctness. Unreal seems to have occasional issues with
+        // zero UV sets when building lightmaps.
+        if ( SrcModel->BuildSettings.bGenerateLightmapUVs )
         {
-            SrcModel->BuildSettings.bGenerateLightmapUVs = false;
+            // See if we need to disable lightmap generation because of bad UVs.
+            if ( FHoudiniEngineUtils::ContainsInvalidLightmapFaces( RawMesh, StaticMesh->LightMapCoordinateIndex ) )
+            {
+                SrcModel->BuildSettings.bGenerateLightmapUVs = false;
 
-            HOUDINI_LOG_MESSAGE(
-                TEXT( "Skipping Lightmap Generation: Object %s " )
-                TEXT( "- skipping." ),
-                *MeshName );
+                HOUDINI_LOG_MESSAGE(
+                    TEXT( "Skipping Lightmap Generation: Object %s " )
+                    TEXT( "- skipping." ),
+                    *MeshName );
+            }
         }
+
+        // Store the new raw mesh.
+        SrcModel->RawMeshBulkData->SaveRawMesh( RawMesh );
     }
 
-    // Store the new raw mesh.
-    RawMeshBulkData->SaveRawMesh( RawMesh );
+    if ( bHasImportedLODs )
+    {
+        // Imported LODs are used as is, LOD group defaults would add automatic reduction over them.
+        StaticMesh->bAutoComputeLODScreenSize = InStaticMesh->bAutoComputeLODScreenSize;
+    }
+    else
+    {
+        while ( StaticMesh->SourceModels.Num() < NumLODs )
+            new ( StaticMesh->SourceModels ) FStaticMeshSourceModel();
 
-    while ( StaticMesh->SourceModels.Num() < NumLODs )
-        new ( StaticMesh->SourceModels ) FStaticMeshSourceModel();
+        for ( int32 ModelLODIndex = 0; ModelLODIndex < NumLODs; ++ModelLODIndex )
+            StaticMesh->SourceModels[ ModelLODIndex ].ReductionSettings = LODGroup.GetDefaultSettings( ModelLODIndex );
+    }
 
-    for ( int32 ModelLODIndex = 0; ModelLODIndex < NumLODs; ++ModelLODIndex )
+    for ( int32 ModelLODIndex = 0; ModelLODIndex < StaticMesh->SourceModels.Num(); ++ModelLODIndex )
     {
-        StaticMesh->SourceModels[ ModelLODIndex ].ReductionSettings = LODGroup.GetDefaultSettings( ModelLODIndex );
-
         for ( int32 MaterialIndex = 0; MaterialIndex < StaticMesh->StaticMaterials.Num(); ++MaterialIndex )
         {
             FMeshSectionInfo Info = StaticMesh->SectionInfoMap.Get( ModelLODIndex, MaterialIndex );
@@ -8908,6 +10834,63 @@ FHoudiniEngineUtils::HapiGetVertexListForGroup(
     return ProcessedWedges;
 }
 
+int32
+FHoudiniEngineUtils::GetVertexListForLOD(
+    int32 LODIndex, const TArray< int32 > & FaceLODs,
+    const TArray< int32 > & FullVertexList, TArray< int32 > & NewVertexList,
+    TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
+    TArray< int32 > & AllCollisionFaceIndices )
+{
+    NewVertexList.Init( -1, FullVertexList.Num() );
+    int32 ProcessedWedges = 0;
+
+    AllFaceList.Empty();
+
+    // Go through all primitives.
+    int32 FaceCount = FMath::Min( FaceLODs.Num(), FullVertexList.Num() / 3 );
+    for ( int32 FaceIdx = 0; FaceIdx < FaceCount; ++FaceIdx )
+    {
+        if ( FaceLODs[ FaceIdx ] == LODIndex )
+        {
+            // Add face.
+            AllFaceList.Add( FaceIdx );
+
+            // This face belongs to specified LOD.
+            NewVertexList[ FaceIdx * 3 + 0 ] = FullVertexList[ FaceIdx * 3 + 0 ];
+            NewVertexList[ FaceIdx * 3 + 1 ] = FullVertexList[ FaceIdx * 3 + 1 ];
+            NewVertexList[ FaceIdx * 3 + 2 ] = FullVertexList[ FaceIdx * 3 + 2 ];
+
+            // Mark these vertex indices as used.
+            AllVertexList[ FaceIdx * 3 + 0 ] = 1;
+            AllVertexList[ FaceIdx * 3 + 1 ] = 1;
+            AllVertexList[ FaceIdx * 3 + 2 ] = 1;
+
+            // Mark this face as used.
+            AllCollisionFaceIndices[ FaceIdx ] = 1;
+
+            ProcessedWedges += 3;
+        }
+    }
+
+    return ProcessedWedges;
+}
+
+int32
+FHoudiniEngineUtils::GetLODIndexFromGroupName( const FString & GroupName )
+{
+    static const FString LODGroupPrefix = TEXT( HAPI_UNREAL_GROUP_LOD_PREFIX );
+
+    if ( !GroupName.StartsWith( LODGroupPrefix, ESearchCase::IgnoreCase ) )
+        return INDEX_NONE;
+
+    // Only accept lod followed by a number, so that groups like lodge or lod_high are left alone.
+    FString LODIndexString = GroupName.RightChop( LODGroupPrefix.Len() );
+    if ( LODIndexString.IsEmpty() || !LODIndexString.IsNumeric() || LODIndexString.Contains( TEXT( "." ) ) )
+        return INDEX_NONE;
+
+    return FCString::Atoi( *LODIndexString );
+}
+
 
 #if WITH_EDITOR
 
@@ -9174,76 +11157,469 @@ FHoudiniEngineUtils::LocateClipboardActor( const AActor* IgnoreActor, const FStr
 	}
     }
 
-#if WITH_EDITOR
-    // And try to find the corresponding HoudiniAssetActor in the editor world
-    // to avoid finding "deleted" assets with the same name
-    UWorld* editorWorld = GEditor->GetEditorWorldContext().World();
-    for (TActorIterator<AHoudiniAssetActor> ActorItr(editorWorld); ActorItr; ++ActorItr)
+#if WITH_EDITOR
+    // And try to find the corresponding HoudiniAssetActor in the editor world
+    // to avoid finding "deleted" assets with the same name
+    UWorld* editorWorld = GEditor->GetEditorWorldContext().World();
+    for (TActorIterator<AHoudiniAssetActor> ActorItr(editorWorld); ActorItr; ++ActorItr)
+    {
+	if ( *ActorItr != IgnoreActor && (ActorItr->GetActorLabel() == ActorName || ActorItr->GetName() == ActorName))
+	    HoudiniAssetActor = *ActorItr;
+    }
+#endif
+
+    return HoudiniAssetActor;
+}
+
+/** Apply rotation and scale offsets to instance transforms. **/
+inline void
+HoudiniApplyInstancedTransformOffsets(
+    const TArray< FTransform > & InstancedTransforms,
+    const FRotator & RotationOffset, const FVector & ScaleOffset,
+    TArray< FTransform > & ProcessedTransforms )
+{
+    ProcessedTransforms.SetNumUninitialized( InstancedTransforms.Num() );
+
+    for ( int32 InstanceIdx = 0; InstanceIdx < InstancedTransforms.Num(); ++InstanceIdx )
+    {
+        FTransform Transform = InstancedTransforms[ InstanceIdx ];
+
+        // Compute new rotation and scale.
+        FQuat TransformRotation = Transform.GetRotation() * RotationOffset.Quaternion();
+        FVector TransformScale3D = Transform.GetScale3D() * ScaleOffset;
+
+        // Make sure inverse matrix exists - seems to be a bug in Unreal when submitting instances.
+        // Happens in blueprint as well.
+        if ( TransformScale3D.X < HAPI_UNREAL_SCALE_SMALL_VALUE )
+            TransformScale3D.X = HAPI_UNREAL_SCALE_SMALL_VALUE;
+
+        if ( TransformScale3D.Y < HAPI_UNREAL_SCALE_SMALL_VALUE )
+            TransformScale3D.Y = HAPI_UNREAL_SCALE_SMALL_VALUE;
+
+        if ( TransformScale3D.Z < HAPI_UNREAL_SCALE_SMALL_VALUE )
+            TransformScale3D.Z = HAPI_UNREAL_SCALE_SMALL_VALUE;
+
+        Transform.SetRotation( TransformRotation );
+        Transform.SetScale3D( TransformScale3D );
+
+        ProcessedTransforms[ InstanceIdx ] = Transform;
+    }
+}
+
+/** Return true if the instance at given index of the component has given transform. **/
+inline bool
+HoudiniIsInstanceTransformEqual(
+    const UInstancedStaticMeshComponent * InstancedStaticMeshComponent,
+    int32 InstanceIdx, const FTransform & Transform )
+{
+    return InstancedStaticMeshComponent->PerInstanceSMData[ InstanceIdx ].Transform.Equals(
+        Transform.ToMatrixWithScale(), KINDA_SMALL_NUMBER );
+}
+
+/** Mark render state of an updated instanced component dirty and start building the cluster tree of hierarchical ones. **/
+inline void
+HoudiniFinishInstancedStaticMeshComponentUpdate( UInstancedStaticMeshComponent * InstancedStaticMeshComponent )
+{
+    InstancedStaticMeshComponent->MarkRenderStateDirty();
+
+    // The cluster tree is built in the background, so the cook is not blocked by it.
+    UHierarchicalInstancedStaticMeshComponent * HISMC =
+        Cast< UHierarchicalInstancedStaticMeshComponent >( InstancedStaticMeshComponent );
+    if ( HISMC && HISMC->IsRegistered() )
+        HISMC->BuildTreeIfOutdated( true, false );
+}
+
+void
+FHoudiniEngineUtils::UpdateInstancedStaticMeshComponentInstances(
+    USceneComponent * Component,
+    const TArray< FTransform > & InstancedTransforms,
+    const FRotator & RotationOffset, const FVector & ScaleOffset )
+{
+    UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>( Component );
+    UHoudiniInstancedActorComponent* IAC = Cast<UHoudiniInstancedActorComponent>( Component );
+    
+    check( ISMC || IAC );
+
+    TArray< FTransform > ProcessedTransforms;
+    HoudiniApplyInstancedTransformOffsets( InstancedTransforms, RotationOffset, ScaleOffset, ProcessedTransforms );
+
+    if ( IAC )
+    {
+        IAC->SetInstances( ProcessedTransforms );
+        return;
+    }
+
+    // Without ids, the existing instance at a given index corresponds to the new instance at the same index.
+    const int32 ExistingInstanceCount = ISMC->PerInstanceSMData.Num();
+    const int32 NewInstanceCount = ProcessedTransforms.Num();
+    const int32 CommonInstanceCount = FMath::Min( ExistingInstanceCount, NewInstanceCount );
+
+    TArray< int32 > ChangedInstances;
+    for ( int32 InstanceIdx = 0; InstanceIdx < CommonInstanceCount; ++InstanceIdx )
+    {
+        if ( !HoudiniIsInstanceTransformEqual( ISMC, InstanceIdx, ProcessedTransforms[ InstanceIdx ] ) )
+            ChangedInstances.Add( InstanceIdx );
+    }
+
+    const int32 ChangeCount = ChangedInstances.Num() + FMath::Abs( NewInstanceCount - ExistingInstanceCount );
+    if ( ChangeCount == 0 )
+        return;
+
+    if ( ChangeCount > NewInstanceCount * HAPI_UNREAL_INSTANCE_INCREMENTAL_UPDATE_RATIO )
+    {
+        FHoudiniEngineUtils::ReplaceInstancedStaticMeshComponentInstances( ISMC, ProcessedTransforms );
+        return;
+    }
+
+    for ( int32 InstanceIdx : ChangedInstances )
+        ISMC->UpdateInstanceTransform( InstanceIdx, ProcessedTransforms[ InstanceIdx ], false, false );
+
+    for ( int32 InstanceIdx = ExistingInstanceCount - 1; InstanceIdx >= NewInstanceCount; --InstanceIdx )
+        ISMC->RemoveInstance( InstanceIdx );
+
+    for ( int32 InstanceIdx = ExistingInstanceCount; InstanceIdx < NewInstanceCount; ++InstanceIdx )
+        ISMC->AddInstance( ProcessedTransforms[ InstanceIdx ] );
+
+    HoudiniFinishInstancedStaticMeshComponentUpdate( ISMC );
+}
+
+void
+FHoudiniEngineUtils::UpdateInstancedStaticMeshComponentInstances(
+    USceneComponent * Component,
+    const TArray< FTransform > & InstancedTransforms,
+    const TArray< int32 > & InstanceIds,
+    TArray< int32 > & InOutComponentInstanceIds,
+    const FRotator & RotationOffset, const FVector & ScaleOffset )
+{
+    UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>( Component );
+
+    // Map each id to its new instance, ids can only be used if they are unique.
+    TMap< int32, int32 > NewInstanceIndices;
+    bool bUseInstanceIds = ISMC && InstanceIds.Num() > 0 && InstanceIds.Num() == InstancedTransforms.Num();
+    if ( bUseInstanceIds )
+    {
+        NewInstanceIndices.Reserve( InstanceIds.Num() );
+        for ( int32 InstanceIdx = 0; InstanceIdx < InstanceIds.Num(); ++InstanceIdx )
+        {
+            if ( NewInstanceIndices.Contains( InstanceIds[ InstanceIdx ] ) )
+            {
+                bUseInstanceIds = false;
+                break;
+            }
+
+            NewInstanceIndices.Add( InstanceIds[ InstanceIdx ], InstanceIdx );
+        }
+    }
+
+    if ( !bUseInstanceIds )
+    {
+        FHoudiniEngineUtils::UpdateInstancedStaticMeshComponentInstances(
+            Component, InstancedTransforms, RotationOffset, ScaleOffset );
+        InOutComponentInstanceIds.Empty();
+        return;
+    }
+
+    TArray< FTransform > ProcessedTransforms;
+    HoudiniApplyInstancedTransformOffsets( InstancedTransforms, RotationOffset, ScaleOffset, ProcessedTransforms );
+
+    // We need to know the id of every existing instance to match them, otherwise refill the component.
+    const int32 ExistingInstanceCount = ISMC->PerInstanceSMData.Num();
+    if ( InOutComponentInstanceIds.Num() != ExistingInstanceCount )
+    {
+        FHoudiniEngineUtils::ReplaceInstancedStaticMeshComponentInstances( ISMC, ProcessedTransforms );
+        InOutComponentInstanceIds = InstanceIds;
+        return;
+    }
+
+    // Match existing instances with new instances through their ids.
+    TArray< TPair< int32, int32 > > ChangedInstances;
+    TArray< int32 > FreeInstances;
+    TBitArray<> MatchedNewInstances( false, ProcessedTransforms.Num() );
+
+    for ( int32 InstanceIdx = 0; InstanceIdx < ExistingInstanceCount; ++InstanceIdx )
+    {
+        const int32 * NewInstanceIdx = NewInstanceIndices.Find( InOutComponentInstanceIds[ InstanceIdx ] );
+        if ( !NewInstanceIdx || MatchedNewInstances[ *NewInstanceIdx ] )
+        {
+            FreeInstances.Add( InstanceIdx );
+            continue;
+        }
+
+        MatchedNewInstances[ *NewInstanceIdx ] = true;
+        if ( !HoudiniIsInstanceTransformEqual( ISMC, InstanceIdx, ProcessedTransforms[ *NewInstanceIdx ] ) )
+            ChangedInstances.Add( TPair< int32, int32 >( InstanceIdx, *NewInstanceIdx ) );
+    }
+
+    TArray< int32 > AddedInstances;
+    for ( int32 NewInstanceIdx = 0; NewInstanceIdx < ProcessedTransforms.Num(); ++NewInstanceIdx )
+    {
+        if ( !MatchedNewInstances[ NewInstanceIdx ] )
+            AddedInstances.Add( NewInstanceIdx );
+    }
+
+    // Instances of removed ids are reused for added ids before anything gets added or removed.
+    const int32 ChangeCount = ChangedInstances.Num() + FMath::Max( FreeInstances.Num(), AddedInstances.Num() );
+    if ( ChangeCount == 0 )
+        return;
+
+    if ( ChangeCount > ProcessedTransforms.Num() * HAPI_UNREAL_INSTANCE_INCREMENTAL_UPDATE_RATIO )
+    {
+        FHoudiniEngineUtils::ReplaceInstancedStaticMeshComponentInstances( ISMC, ProcessedTransforms );
+        InOutComponentInstanceIds = InstanceIds;
+        return;
+    }
+
+    for ( const TPair< int32, int32 > & ChangedInstance : ChangedInstances )
+        ISMC->UpdateInstanceTransform( ChangedInstance.Key, ProcessedTransforms[ ChangedInstance.Value ], false, false );
+
+    const int32 ReusedInstanceCount = FMath::Min( FreeInstances.Num(), AddedInstances.Num() );
+    for ( int32 Idx = 0; Idx < ReusedInstanceCount; ++Idx )
+    {
+        ISMC->UpdateInstanceTransform( FreeInstances[ Idx ], ProcessedTransforms[ AddedInstances[ Idx ] ], false, false );
+        InOutComponentInstanceIds[ FreeInstances[ Idx ] ] = InstanceIds[ AddedInstances[ Idx ] ];
+    }
+
+    // Remove from the back so that indices of remaining free instances stay valid. Hierarchical components
+    // move their last instance into the removed slot, plain ones shift the following instances.
+    const bool bIsHierarchical = ISMC->IsA< UHierarchicalInstancedStaticMeshComponent >();
+    for ( int32 Idx = FreeInstances.Num() - 1; Idx >= ReusedInstanceCount; --Idx )
+    {
+        ISMC->RemoveInstance( FreeInstances[ Idx ] );
+
+        if ( bIsHierarchical )
+            InOutComponentInstanceIds.RemoveAtSwap( FreeInstances[ Idx ], 1, false );
+        else
+            InOutComponentInstanceIds.RemoveAt( FreeInstances[ Idx ], 1, false );
+    }
+
+    for ( int32 Idx = ReusedInstanceCount; Idx < AddedInstances.Num(); ++Idx )
+    {
+        ISMC->AddInstance( ProcessedTransforms[ AddedInstances[ Idx ] ] );
+        InOutComponentInstanceIds.Add( InstanceIds[ AddedInstances[ Idx ] ] );
+    }
+
+    HoudiniFinishInstancedStaticMeshComponentUpdate( ISMC );
+}
+
+void
+FHoudiniEngineUtils::ReplaceInstancedStaticMeshComponentInstances(
+    UInstancedStaticMeshComponent * InstancedStaticMeshComponent,
+    const TArray< FTransform > & InstancedTransforms )
+{
+    // Clearing releases instance bodies and render data of the previous instances.
+    InstancedStaticMeshComponent->ClearInstances();
+
+    // Hierarchical components keep their own instance bookkeeping, their instances are added one by one
+    // but the cluster tree is built only once, in the background.
+    if ( InstancedStaticMeshComponent->IsA< UHierarchicalInstancedStaticMeshComponent >() )
+    {
+        for ( const FTransform & InstancedTransform : InstancedTransforms )
+            InstancedStaticMeshComponent->AddInstance( InstancedTransform );
+
+        HoudiniFinishInstancedStaticMeshComponentUpdate( InstancedStaticMeshComponent );
+        return;
+    }
+
+    TArray< FInstancedStaticMeshInstanceData > & PerInstanceSMData = InstancedStaticMeshComponent->PerInstanceSMData;
+    PerInstanceSMData.SetNumUninitialized( InstancedTransforms.Num() );
+
+    for ( int32 InstanceIdx = 0; InstanceIdx < InstancedTransforms.Num(); ++InstanceIdx )
     {
-	if ( *ActorItr != IgnoreActor && (ActorItr->GetActorLabel() == ActorName || ActorItr->GetName() == ActorName))
-	    HoudiniAssetActor = *ActorItr;
+        FInstancedStaticMeshInstanceData & InstanceData = PerInstanceSMData[ InstanceIdx ];
+        InstanceData.Transform = InstancedTransforms[ InstanceIdx ].ToMatrixWithScale();
+        InstanceData.LightmapUVBias = FVector2D( -1.0f, -1.0f );
+        InstanceData.ShadowmapUVBias = FVector2D( -1.0f, -1.0f );
     }
-#endif
 
-    return HoudiniAssetActor;
+    // Instance bodies, render data and navigation are rebuilt once for the whole set.
+    if ( InstancedStaticMeshComponent->IsPhysicsStateCreated() )
+        InstancedStaticMeshComponent->RecreatePhysicsState();
+
+    InstancedStaticMeshComponent->MarkRenderStateDirty();
+    UNavigationSystem::UpdateComponentInNavOctree( *InstancedStaticMeshComponent );
+}
+
+#if WITH_EDITOR
+
+/** Order foliage instance transforms by location. Locations are stored exactly, unlike rotations. **/
+inline bool
+HoudiniFoliageTransformLess( const FTransform & A, const FTransform & B )
+{
+    const FVector LocationA = A.GetLocation();
+    const FVector LocationB = B.GetLocation();
+
+    if ( LocationA.X != LocationB.X )
+        return LocationA.X < LocationB.X;
+
+    if ( LocationA.Y != LocationB.Y )
+        return LocationA.Y < LocationB.Y;
+
+    return LocationA.Z < LocationB.Z;
 }
 
 void
-FHoudiniEngineUtils::UpdateInstancedStaticMeshComponentInstances(
-    USceneComponent * Component,
+FHoudiniEngineUtils::UpdateFoliageInstances(
+    USceneComponent * BaseComponent,
+    UStaticMesh * StaticMesh,
+    UFoliageType_InstancedStaticMesh * DefaultSettings,
     const TArray< FTransform > & InstancedTransforms,
     const FRotator & RotationOffset, const FVector & ScaleOffset )
 {
-    UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>( Component );
-    UHoudiniInstancedActorComponent* IAC = Cast<UHoudiniInstancedActorComponent>( Component );
-    
-    check( ISMC || IAC );
+    if ( !BaseComponent || !BaseComponent->GetComponentLevel() )
+        return;
+
+    AInstancedFoliageActor * InstancedFoliageActor =
+        AInstancedFoliageActor::GetInstancedFoliageActorForLevel( BaseComponent->GetComponentLevel(), StaticMesh != nullptr );
+
+    if ( !InstancedFoliageActor )
+        return;
 
-    auto ProcessOffsets = [&]() {
-        TArray<FTransform> ProcessedTransforms;
-        ProcessedTransforms.Reserve( InstancedTransforms.Num() );
+    // Foliage instances are stored in world space.
+    TArray< FTransform > WorldTransforms;
+    HoudiniApplyInstancedTransformOffsets( InstancedTransforms, RotationOffset, ScaleOffset, WorldTransforms );
 
-        for ( int32 InstanceIdx = 0; InstanceIdx < InstancedTransforms.Num(); ++InstanceIdx )
+    const FTransform & ComponentTransform = BaseComponent->GetComponentTransform();
+    for ( FTransform & WorldTransform : WorldTransforms )
+        WorldTransform = WorldTransform * ComponentTransform;
+
+    // Locate the foliage type using this mesh, or create one from the default settings.
+    UFoliageType * FoliageType = nullptr;
+    if ( StaticMesh )
+    {
+        for ( auto & FoliageMeshPair : InstancedFoliageActor->FoliageMeshes )
+        {
+            if ( FoliageMeshPair.Key && FoliageMeshPair.Key->GetStaticMesh() == StaticMesh )
+            {
+                FoliageType = FoliageMeshPair.Key;
+                break;
+            }
+        }
+
+        if ( !FoliageType )
         {
-            FTransform Transform = InstancedTransforms[ InstanceIdx ];
+            // Created foliage types are named so that they can be told apart from the ones placed by users.
+            const FName FoliageTypeName = MakeUniqueObjectName(
+                InstancedFoliageActor, UFoliageType_InstancedStaticMesh::StaticClass(), HAPI_UNREAL_FOLIAGE_TYPE_PREFIX );
+
+            UFoliageType_InstancedStaticMesh * NewFoliageType = DefaultSettings ?
+                DuplicateObject< UFoliageType_InstancedStaticMesh >( DefaultSettings, InstancedFoliageActor, FoliageTypeName ) :
+                NewObject< UFoliageType_InstancedStaticMesh >( InstancedFoliageActor, FoliageTypeName, RF_Transactional );
+
+            NewFoliageType->SetStaticMesh( StaticMesh );
+            InstancedFoliageActor->AddMesh( NewFoliageType );
+            FoliageType = NewFoliageType;
+        }
+    }
+
+    // Instances are owned through their base component, instances placed by anything else are left untouched.
+    const FFoliageInstanceBaseId BaseId = InstancedFoliageActor->InstanceBaseCache.GetInstanceBaseId( BaseComponent );
+
+    // Foliage stores rotations as rotators, so compare with a tolerance which survives the conversion.
+    static const float FoliageTransformTolerance = 1.e-3f;
+
+    bool bNeedToAddInstances = FoliageType != nullptr;
+    bool bWorldTransformsSorted = false;
+    TArray< FFoliageMeshInfo * > UpdatedMeshInfos;
+
+    for ( auto & FoliageMeshPair : InstancedFoliageActor->FoliageMeshes )
+    {
+        FFoliageMeshInfo & MeshInfo = *FoliageMeshPair.Value;
+
+        const TSet< int32 > * OwnedInstanceSet = nullptr;
+        if ( BaseId != FFoliageInstanceBaseCache::InvalidBaseId )
+            OwnedInstanceSet = MeshInfo.ComponentHash.Find( BaseId );
+
+        if ( !OwnedInstanceSet || OwnedInstanceSet->Num() == 0 )
+            continue;
 
-            // Compute new rotation and scale.
-            FQuat TransformRotation = Transform.GetRotation() * RotationOffset.Quaternion();
-            FVector TransformScale3D = Transform.GetScale3D() * ScaleOffset;
+        TArray< int32 > OwnedInstances = OwnedInstanceSet->Array();
 
-            // Make sure inverse matrix exists - seems to be a bug in Unreal when submitting instances.
-            // Happens in blueprint as well.
-            if ( TransformScale3D.X < HAPI_UNREAL_SCALE_SMALL_VALUE )
-                TransformScale3D.X = HAPI_UNREAL_SCALE_SMALL_VALUE;
+        // Instances of our foliage type are kept if none of them has changed. Removing instances reorders the
+        // remaining ones, so both sides are compared in the order of their locations.
+        if ( FoliageMeshPair.Key == FoliageType && OwnedInstances.Num() == WorldTransforms.Num() )
+        {
+            TArray< FTransform > OwnedTransforms;
+            OwnedTransforms.Reserve( OwnedInstances.Num() );
+            for ( int32 OwnedInstance : OwnedInstances )
+                OwnedTransforms.Add( MeshInfo.Instances[ OwnedInstance ].GetInstanceWorldTransform() );
 
-            if ( TransformScale3D.Y < HAPI_UNREAL_SCALE_SMALL_VALUE )
-                TransformScale3D.Y = HAPI_UNREAL_SCALE_SMALL_VALUE;
+            if ( !bWorldTransformsSorted )
+            {
+                WorldTransforms.Sort( HoudiniFoliageTransformLess );
+                bWorldTransformsSorted = true;
+            }
 
-            if ( TransformScale3D.Z < HAPI_UNREAL_SCALE_SMALL_VALUE )
-                TransformScale3D.Z = HAPI_UNREAL_SCALE_SMALL_VALUE;
+            OwnedTransforms.Sort( HoudiniFoliageTransformLess );
 
-            Transform.SetRotation( TransformRotation );
-            Transform.SetScale3D( TransformScale3D );
+            bool bInstancesChanged = false;
+            for ( int32 Idx = 0; Idx < OwnedTransforms.Num() && !bInstancesChanged; ++Idx )
+                bInstancesChanged = !OwnedTransforms[ Idx ].Equals( WorldTransforms[ Idx ], FoliageTransformTolerance );
 
-            ProcessedTransforms.Add( Transform );
+            if ( !bInstancesChanged )
+            {
+                bNeedToAddInstances = false;
+                continue;
+            }
         }
-        return ProcessedTransforms;
-    };
 
-    if ( ISMC )
+        MeshInfo.RemoveInstances( InstancedFoliageActor, OwnedInstances, false );
+        UpdatedMeshInfos.AddUnique( &MeshInfo );
+    }
+
+    if ( bNeedToAddInstances )
+    {
+        if ( FFoliageMeshInfo * MeshInfo = InstancedFoliageActor->FindMesh( FoliageType ) )
+        {
+            for ( const FTransform & WorldTransform : WorldTransforms )
+            {
+                FFoliageInstance FoliageInstance;
+                FoliageInstance.Location = WorldTransform.GetLocation();
+                FoliageInstance.Rotation = WorldTransform.GetRotation().Rotator();
+                FoliageInstance.DrawScale3D = WorldTransform.GetScale3D();
+
+                MeshInfo->AddInstance( InstancedFoliageActor, FoliageType, FoliageInstance, BaseComponent );
+            }
+
+            UpdatedMeshInfos.AddUnique( MeshInfo );
+        }
+    }
+
+    // Foliage types created for instancer output which no longer have instances would keep their meshes alive.
+    TArray< UFoliageType * > EmptyFoliageTypes;
+    for ( auto & FoliageMeshPair : InstancedFoliageActor->FoliageMeshes )
     {
-        ISMC->ClearInstances();
-        for ( const auto& Transform : ProcessOffsets() )
+        UFoliageType * EmptyFoliageType = FoliageMeshPair.Key;
+        if ( EmptyFoliageType && EmptyFoliageType != FoliageType && FoliageMeshPair.Value->Instances.Num() == 0
+            && EmptyFoliageType->GetOuter() == InstancedFoliageActor
+            && EmptyFoliageType->GetName().StartsWith( HAPI_UNREAL_FOLIAGE_TYPE_PREFIX ) )
         {
-            ISMC->AddInstance( Transform );
+            EmptyFoliageTypes.Add( EmptyFoliageType );
         }
     }
-    else if ( IAC )
+
+    for ( UFoliageType * EmptyFoliageType : EmptyFoliageTypes )
+        UpdatedMeshInfos.Remove( InstancedFoliageActor->FindMesh( EmptyFoliageType ) );
+
+    if ( EmptyFoliageTypes.Num() > 0 )
+        InstancedFoliageActor->RemoveFoliageType( EmptyFoliageTypes.GetData(), EmptyFoliageTypes.Num() );
+
+    // Cluster trees of the foliage components are built in the background.
+    for ( FFoliageMeshInfo * MeshInfo : UpdatedMeshInfos )
     {
-        IAC->SetInstances( ProcessOffsets() );
+        if ( MeshInfo->Component )
+            MeshInfo->Component->BuildTreeIfOutdated( true, false );
     }
 }
 
+void
+FHoudiniEngineUtils::ClearFoliageInstances( USceneComponent * BaseComponent )
+{
+    FHoudiniEngineUtils::UpdateFoliageInstances(
+        BaseComponent, nullptr, nullptr, TArray< FTransform >(), FRotator::ZeroRotator, FVector::OneVector );
+}
+
+#endif
+
 bool
 FHoudiniEngineUtils::GetAssetNames(
     UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & OutAssetLibraryId,
@@ -9374,6 +11750,10 @@ FHoudiniEngineUtils::DuplicateStaticMeshAndCreatePackage(
 
     if ( !HoudiniGeoPartObject.IsCurve() && !HoudiniGeoPartObject.IsInstancer() && !HoudiniGeoPartObject.IsPackedPrimitiveInstancer() )
     {
+        // Baked meshes should not inherit a preview build.
+        if ( BakeMode != EBakeMode::Intermediate && Component )
+            Component->BuildPendingFullQualityStaticMeshes();
+
         // Create package for this duplicated mesh.
         FString MeshName;
         FGuid MeshGuid;
@@ -10196,9 +12576,7 @@ FHoudiniEngineUtils::AddAggregateCollisionGeometryToStaticMesh(
     BodySetup->ClearPhysicsMeshes();
     BodySetup->InvalidatePhysicsData();
 
-#if WITH_EDITOR
-    RefreshCollisionChange( StaticMesh );
-#endif
+    // Navigation collision and physics state are refreshed by the caller, once all collisions have been added.
 
     // This geo part will have to be considered as rendered collision
     if ( !HoudiniGeoPartObject.bIsCollidable )
@@ -10213,6 +12591,434 @@ FHoudiniEngineUtils::AddAggregateCollisionGeometryToStaticMesh(
     return true;
 }
 
+void
+FHoudiniEngineUtils::RefreshCollisionChanges( const TSet< UStaticMesh * > & StaticMeshes )
+{
+#if WITH_EDITOR
+    if ( StaticMeshes.Num() <= 0 )
+        return;
+
+    // Unreal caches the Navigation Collision and never updates it for StaticMeshes,
+    // so we need to manually flush and recreate the data to have proper navigation collision
+    for ( TSet< UStaticMesh * >::TConstIterator Iter( StaticMeshes ); Iter; ++Iter )
+    {
+        UStaticMesh * StaticMesh = *Iter;
+        if ( !StaticMesh || StaticMesh->IsPendingKill() || !StaticMesh->BodySetup )
+            continue;
+
+        if ( StaticMesh->NavCollision )
+        {
+            StaticMesh->NavCollision->CookedFormatData.FlushData();
+            StaticMesh->NavCollision->GatherCollision();
+            StaticMesh->NavCollision->Setup( StaticMesh->BodySetup );
+        }
+    }
+
+    // Recreate the physics state of the components using these meshes. Unlike calling RefreshCollisionChange
+    // for each mesh, this only goes through all the static mesh components once.
+    for ( TObjectIterator< UStaticMeshComponent > Iter; Iter; ++Iter )
+    {
+        UStaticMeshComponent * StaticMeshComponent = *Iter;
+        if ( !StaticMeshComponent || !StaticMeshComponent->IsPhysicsStateCreated() )
+            continue;
+
+        if ( StaticMeshes.Contains( StaticMeshComponent->GetStaticMesh() ) )
+            StaticMeshComponent->RecreatePhysicsState();
+    }
+#endif
+}
+
+void
+FHoudiniEngineUtils::ComputeConvexHull(
+    const TArray< FVector > & Points, int32 MaxHullVertices, TArray< FVector > & HullVertices )
+{
+    HullVertices.Empty();
+
+    // Hull triangle, vertices are ordered counter clockwise when looking at the face from the outside.
+    // Neighbours[ i ] is the face across the edge going from Vertices[ i ] to Vertices[ ( i + 1 ) % 3 ].
+    struct FHullFace
+    {
+        int32 Vertices[ 3 ];
+        int32 Neighbours[ 3 ];
+        FPlane Plane;
+        TArray< int32 > OutsidePoints;
+        int32 VisitMark;
+        bool bValid;
+    };
+
+    const int32 PointCount = Points.Num();
+    if ( PointCount < 4 )
+    {
+        HullVertices = Points;
+        return;
+    }
+
+    // Tolerance used to decide whether a point is above a face, relative to the size of the point cloud.
+    FBox Bounds( Points );
+    const FVector MaxAbs = Bounds.Max.GetAbs().ComponentMax( Bounds.Min.GetAbs() );
+    const float Epsilon = 3.0f * FLT_EPSILON * ( MaxAbs.X + MaxAbs.Y + MaxAbs.Z );
+
+    // Find the initial tetrahedron, start with the most distant pair of axis extreme points.
+    int32 Extremes[ 6 ] = { 0, 0, 0, 0, 0, 0 };
+    for ( int32 PointIdx = 1; PointIdx < PointCount; ++PointIdx )
+    {
+        for ( int32 Axis = 0; Axis < 3; ++Axis )
+        {
+            if ( Points[ PointIdx ][ Axis ] < Points[ Extremes[ Axis * 2 + 0 ] ][ Axis ] )
+                Extremes[ Axis * 2 + 0 ] = PointIdx;
+            if ( Points[ PointIdx ][ Axis ] > Points[ Extremes[ Axis * 2 + 1 ] ][ Axis ] )
+                Extremes[ Axis * 2 + 1 ] = PointIdx;
+        }
+    }
+
+    int32 Simplex[ 4 ] = { Extremes[ 0 ], Extremes[ 1 ], -1, -1 };
+    float MaxDistance = -1.0f;
+    for ( int32 Axis = 0; Axis < 3; ++Axis )
+    {
+        float Distance = FVector::DistSquared( Points[ Extremes[ Axis * 2 + 0 ] ], Points[ Extremes[ Axis * 2 + 1 ] ] );
+        if ( Distance > MaxDistance )
+        {
+            MaxDistance = Distance;
+            Simplex[ 0 ] = Extremes[ Axis * 2 + 0 ];
+            Simplex[ 1 ] = Extremes[ Axis * 2 + 1 ];
+        }
+    }
+
+    // Third point is the furthest from the line, fourth is the furthest from the plane.
+    MaxDistance = Epsilon;
+    for ( int32 PointIdx = 0; PointIdx < PointCount; ++PointIdx )
+    {
+        float Distance = FMath::PointDistToLine(
+            Points[ PointIdx ], Points[ Simplex[ 1 ] ] - Points[ Simplex[ 0 ] ], Points[ Simplex[ 0 ] ] );
+        if ( Distance > MaxDistance )
+        {
+            MaxDistance = Distance;
+            Simplex[ 2 ] = PointIdx;
+        }
+    }
+
+    if ( Simplex[ 2 ] == -1 )
+    {
+        // Degenerate, all points are on a line.
+        HullVertices = Points;
+        return;
+    }
+
+    FPlane BasePlane( Points[ Simplex[ 0 ] ], Points[ Simplex[ 1 ] ], Points[ Simplex[ 2 ] ] );
+    MaxDistance = Epsilon;
+    for ( int32 PointIdx = 0; PointIdx < PointCount; ++PointIdx )
+    {
+        float Distance = FMath::Abs( BasePlane.PlaneDot( Points[ PointIdx ] ) );
+        if ( Distance > MaxDistance )
+        {
+            MaxDistance = Distance;
+            Simplex[ 3 ] = PointIdx;
+        }
+    }
+
+    if ( Simplex[ 3 ] == -1 )
+    {
+        // Degenerate, all points are on a plane.
+        HullVertices = Points;
+        return;
+    }
+
+    // Make sure the base triangle faces away from the fourth point.
+    if ( BasePlane.PlaneDot( Points[ Simplex[ 3 ] ] ) > 0.0f )
+        Swap( Simplex[ 1 ], Simplex[ 2 ] );
+
+    // Faces are only referenced by index, the array may grow while faces are created. Removed faces are
+    // recycled through a free list so the array stays about the size of the hull.
+    TArray< FHullFace > Faces;
+    TArray< int32 > FreeFaces;
+    auto AddFace = [ & ]( int32 A, int32 B, int32 C )
+    {
+        int32 FaceIdx = FreeFaces.Num() > 0 ? FreeFaces.Pop( false ) : Faces.AddDefaulted();
+        FHullFace & Face = Faces[ FaceIdx ];
+        Face.Vertices[ 0 ] = A;
+        Face.Vertices[ 1 ] = B;
+        Face.Vertices[ 2 ] = C;
+        Face.Neighbours[ 0 ] = Face.Neighbours[ 1 ] = Face.Neighbours[ 2 ] = -1;
+        Face.Plane = FPlane( Points[ A ], Points[ B ], Points[ C ] );
+        Face.OutsidePoints.Reset();
+        Face.VisitMark = -1;
+        Face.bValid = true;
+        return FaceIdx;
+    };
+
+    // Initial tetrahedron and its adjacency.
+    AddFace( Simplex[ 0 ], Simplex[ 1 ], Simplex[ 2 ] );
+    AddFace( Simplex[ 0 ], Simplex[ 3 ], Simplex[ 1 ] );
+    AddFace( Simplex[ 1 ], Simplex[ 3 ], Simplex[ 2 ] );
+    AddFace( Simplex[ 2 ], Simplex[ 3 ], Simplex[ 0 ] );
+
+    for ( int32 FaceIdx = 0; FaceIdx < 4; ++FaceIdx )
+    {
+        for ( int32 EdgeIdx = 0; EdgeIdx < 3; ++EdgeIdx )
+        {
+            const int32 EdgeStart = Faces[ FaceIdx ].Vertices[ EdgeIdx ];
+            const int32 EdgeEnd = Faces[ FaceIdx ].Vertices[ ( EdgeIdx + 1 ) % 3 ];
+            for ( int32 OtherFaceIdx = 0; OtherFaceIdx < 4; ++OtherFaceIdx )
+            {
+                const FHullFace & OtherFace = Faces[ OtherFaceIdx ];
+                for ( int32 OtherEdgeIdx = 0; OtherFaceIdx != FaceIdx && OtherEdgeIdx < 3; ++OtherEdgeIdx )
+                {
+                    if ( OtherFace.Vertices[ OtherEdgeIdx ] == EdgeEnd
+                        && OtherFace.Vertices[ ( OtherEdgeIdx + 1 ) % 3 ] == EdgeStart )
+                    {
+                        Faces[ FaceIdx ].Neighbours[ EdgeIdx ] = OtherFaceIdx;
+                    }
+                }
+            }
+        }
+    }
+
+    // Conflict lists: each point outside the hull is assigned to one face it is above.
+    for ( int32 PointIdx = 0; PointIdx < PointCount; ++PointIdx )
+    {
+        if ( PointIdx == Simplex[ 0 ] || PointIdx == Simplex[ 1 ] || PointIdx == Simplex[ 2 ] || PointIdx == Simplex[ 3 ] )
+            continue;
+
+        for ( int32 FaceIdx = 0; FaceIdx < 4; ++FaceIdx )
+        {
+            if ( Faces[ FaceIdx ].Plane.PlaneDot( Points[ PointIdx ] ) > Epsilon )
+            {
+                Faces[ FaceIdx ].OutsidePoints.Add( PointIdx );
+                break;
+            }
+        }
+    }
+
+    TArray< int32 > PendingFaces;
+    for ( int32 FaceIdx = 0; FaceIdx < 4; ++FaceIdx )
+    {
+        if ( Faces[ FaceIdx ].OutsidePoints.Num() > 0 )
+            PendingFaces.Add( FaceIdx );
+    }
+
+    struct FHorizonEdge
+    {
+        int32 Start;
+        int32 End;
+        int32 OutsideFace;
+    };
+
+    int32 HullVertexCount = 4;
+    int32 Iteration = 0;
+    TArray< int32 > VisibleFaces;
+    TArray< int32 > VisitStack;
+    TArray< FHorizonEdge > HorizonEdges;
+    TArray< int32 > OrphanPoints;
+    TArray< int32 > NewFaces;
+    TMap< int32, int32 > NewFaceByStart;
+    TMap< int32, int32 > NewFaceByEnd;
+
+    while ( PendingFaces.Num() > 0 )
+    {
+        if ( MaxHullVertices > 0 && HullVertexCount >= MaxHullVertices )
+            break;
+
+        const int32 SeedFaceIdx = PendingFaces.Pop( false );
+        if ( !Faces[ SeedFaceIdx ].bValid || Faces[ SeedFaceIdx ].OutsidePoints.Num() <= 0 )
+            continue;
+
+        // Pick the point of this face's outside set which is the furthest from it.
+        int32 EyePointIdx = -1;
+        float EyeDistance = -1.0f;
+        for ( int32 PointIdx : Faces[ SeedFaceIdx ].OutsidePoints )
+        {
+            float Distance = Faces[ SeedFaceIdx ].Plane.PlaneDot( Points[ PointIdx ] );
+            if ( Distance > EyeDistance )
+            {
+                EyeDistance = Distance;
+                EyePointIdx = PointIdx;
+            }
+        }
+
+        const FVector EyePoint = Points[ EyePointIdx ];
+
+        // Grow the visible region from the seed face through its neighbours. Edges leading to a face
+        // which is not visible form the horizon.
+        ++Iteration;
+        VisibleFaces.Reset();
+        HorizonEdges.Reset();
+        VisitStack.Reset();
+
+        Faces[ SeedFaceIdx ].VisitMark = Iteration;
+        VisitStack.Add( SeedFaceIdx );
+        while ( VisitStack.Num() > 0 )
+        {
+            const int32 FaceIdx = VisitStack.Pop( false );
+            VisibleFaces.Add( FaceIdx );
+
+            for ( int32 EdgeIdx = 0; EdgeIdx < 3; ++EdgeIdx )
+            {
+                const int32 NeighbourIdx = Faces[ FaceIdx ].Neighbours[ EdgeIdx ];
+                if ( NeighbourIdx < 0 || Faces[ NeighbourIdx ].VisitMark == Iteration )
+                    continue;
+
+                if ( Faces[ NeighbourIdx ].Plane.PlaneDot( EyePoint ) > Epsilon )
+                {
+                    Faces[ NeighbourIdx ].VisitMark = Iteration;
+                    VisitStack.Add( NeighbourIdx );
+                }
+                else
+                {
+                    FHorizonEdge HorizonEdge;
+                    HorizonEdge.Start = Faces[ FaceIdx ].Vertices[ EdgeIdx ];
+                    HorizonEdge.End = Faces[ FaceIdx ].Vertices[ ( EdgeIdx + 1 ) % 3 ];
+                    HorizonEdge.OutsideFace = NeighbourIdx;
+                    HorizonEdges.Add( HorizonEdge );
+                }
+            }
+        }
+
+        // Remove the visible faces, keeping their points for reassignment.
+        OrphanPoints.Reset();
+        for ( int32 FaceIdx : VisibleFaces )
+        {
+            OrphanPoints.Append( Faces[ FaceIdx ].OutsidePoints );
+            Faces[ FaceIdx ].OutsidePoints.Reset();
+            Faces[ FaceIdx ].bValid = false;
+            FreeFaces.Add( FaceIdx );
+        }
+
+        // New faces connect the eye point to each horizon edge, keeping the winding of the removed face.
+        NewFaces.Reset();
+        NewFaceByStart.Reset();
+        NewFaceByEnd.Reset();
+        for ( const FHorizonEdge & HorizonEdge : HorizonEdges )
+        {
+            const int32 NewFaceIdx = AddFace( HorizonEdge.Start, HorizonEdge.End, EyePointIdx );
+            NewFaces.Add( NewFaceIdx );
+            NewFaceByStart.Add( HorizonEdge.Start, NewFaceIdx );
+            NewFaceByEnd.Add( HorizonEdge.End, NewFaceIdx );
+
+            // Stitch the new face to the face across the horizon.
+            Faces[ NewFaceIdx ].Neighbours[ 0 ] = HorizonEdge.OutsideFace;
+            FHullFace & OutsideFace = Faces[ HorizonEdge.OutsideFace ];
+            for ( int32 EdgeIdx = 0; EdgeIdx < 3; ++EdgeIdx )
+            {
+                if ( OutsideFace.Vertices[ EdgeIdx ] == HorizonEdge.End
+                    && OutsideFace.Vertices[ ( EdgeIdx + 1 ) % 3 ] == HorizonEdge.Start )
+                {
+                    OutsideFace.Neighbours[ EdgeIdx ] = NewFaceIdx;
+                }
+            }
+        }
+
+        // New faces are neighbours of each other around the eye point.
+        for ( int32 NewFaceIdx : NewFaces )
+        {
+            FHullFace & NewFace = Faces[ NewFaceIdx ];
+            if ( const int32 * NextFaceIdx = NewFaceByStart.Find( NewFace.Vertices[ 1 ] ) )
+                NewFace.Neighbours[ 1 ] = *NextFaceIdx;
+            if ( const int32 * PreviousFaceIdx = NewFaceByEnd.Find( NewFace.Vertices[ 0 ] ) )
+                NewFace.Neighbours[ 2 ] = *PreviousFaceIdx;
+        }
+
+        HullVertexCount++;
+
+        // Reassign the points of the removed faces, the ones not above any new face are now inside.
+        for ( int32 PointIdx : OrphanPoints )
+        {
+            if ( PointIdx == EyePointIdx )
+                continue;
+
+            for ( int32 NewFaceIdx : NewFaces )
+            {
+                if ( Faces[ NewFaceIdx ].Plane.PlaneDot( Points[ PointIdx ] ) > Epsilon )
+                {
+                    Faces[ NewFaceIdx ].OutsidePoints.Add( PointIdx );
+                    break;
+                }
+            }
+        }
+
+        for ( int32 NewFaceIdx : NewFaces )
+        {
+            if ( Faces[ NewFaceIdx ].OutsidePoints.Num() > 0 )
+                PendingFaces.Add( NewFaceIdx );
+        }
+    }
+
+    // Extract the vertices used by the hull.
+    TArray< bool > UsedPoints;
+    UsedPoints.SetNumZeroed( PointCount );
+    for ( const FHullFace & Face : Faces )
+    {
+        if ( !Face.bValid )
+            continue;
+
+        for ( int32 VertexIdx = 0; VertexIdx < 3; ++VertexIdx )
+        {
+            int32 PointIdx = Face.Vertices[ VertexIdx ];
+            if ( !UsedPoints[ PointIdx ] )
+            {
+                UsedPoints[ PointIdx ] = true;
+                HullVertices.Add( Points[ PointIdx ] );
+            }
+        }
+    }
+}
+
+int32
+FHoudiniEngineUtils::GetConnectedPointPieces(
+    const TArray< int32 > & VertexList, int32 PointCount, TArray< TArray< int32 > > & PiecePointIndices )
+{
+    PiecePointIndices.Empty();
+
+    // Union find over the points, points sharing a triangle belong to the same piece.
+    TArray< int32 > Parents;
+    Parents.SetNumUninitialized( PointCount );
+    for ( int32 PointIdx = 0; PointIdx < PointCount; ++PointIdx )
+        Parents[ PointIdx ] = PointIdx;
+
+    auto FindRoot = [ &Parents ]( int32 PointIdx )
+    {
+        while ( Parents[ PointIdx ] != PointIdx )
+        {
+            Parents[ PointIdx ] = Parents[ Parents[ PointIdx ] ];
+            PointIdx = Parents[ PointIdx ];
+        }
+        return PointIdx;
+    };
+
+    TArray< bool > UsedPoints;
+    UsedPoints.SetNumZeroed( PointCount );
+
+    for ( int32 VertexIdx = 0; VertexIdx + 2 < VertexList.Num(); VertexIdx += 3 )
+    {
+        int32 FacePoints[ 3 ] = { VertexList[ VertexIdx + 0 ], VertexList[ VertexIdx + 1 ], VertexList[ VertexIdx + 2 ] };
+        if ( FacePoints[ 0 ] < 0 || FacePoints[ 0 ] >= PointCount
+            || FacePoints[ 1 ] < 0 || FacePoints[ 1 ] >= PointCount
+            || FacePoints[ 2 ] < 0 || FacePoints[ 2 ] >= PointCount )
+            continue;
+
+        UsedPoints[ FacePoints[ 0 ] ] = true;
+        UsedPoints[ FacePoints[ 1 ] ] = true;
+        UsedPoints[ FacePoints[ 2 ] ] = true;
+
+        int32 Root = FindRoot( FacePoints[ 0 ] );
+        Parents[ FindRoot( FacePoints[ 1 ] ) ] = Root;
+        Parents[ FindRoot( FacePoints[ 2 ] ) ] = Root;
+    }
+
+    TMap< int32, int32 > RootToPiece;
+    for ( int32 PointIdx = 0; PointIdx < PointCount; ++PointIdx )
+    {
+        if ( !UsedPoints[ PointIdx ] )
+            continue;
+
+        int32 Root = FindRoot( PointIdx );
+        int32 * FoundPiece = RootToPiece.Find( Root );
+        int32 PieceIdx = FoundPiece ? *FoundPiece : RootToPiece.Add( Root, PiecePointIndices.AddDefaulted() );
+        PiecePointIndices[ PieceIdx ].Add( PointIdx );
+    }
+
+    return PiecePointIndices.Num();
+}
+
 
 bool
 FHoudiniEngineUtils::AddActorsToMeshSocket( UStaticMeshSocket* Socket, UStaticMeshComponent* StaticMeshComponent )
@@ -42,12 +42,14 @@ class UBlueprint;
 class UStaticMesh;
 class UHoudiniAsset;
 class ALandscapeProxy;
+class ULandscapeComponent;
 class AHoudiniAssetActor;
 class UMaterialExpression;
 class UHoudiniAssetMaterial;
 class UHoudiniAssetComponent;
 class FHoudiniAssetObjectGeo;
 class UInstancedStaticMeshComponent;
+class UFoliageType_InstancedStaticMesh;
 class USplineComponent;
 
 struct FRawMesh;
@@ -109,6 +111,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** HAPI : Translate HAPI transform to Unreal one. **/
         static void TranslateHapiTransform( const HAPI_Transform & HapiTransform, FTransform & UnrealTransform );
 
+        /** HAPI : Translate an array of HAPI transforms to Unreal ones, large arrays are converted in parallel. **/
+        static void TranslateHapiTransforms( const TArray< HAPI_Transform > & HapiTransforms, TArray< FTransform > & UnrealTransforms );
+
         /** HAPI : Translate HAPI Euler transform to Unreal one. **/
         static void TranslateHapiTransform( const HAPI_TransformEuler & HapiTransformEuler, FTransform & UnrealTransform );
 
@@ -171,6 +176,38 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const FRotator & RotationOffset,
             const FVector & ScaleOffset );
 
+        /** Update instances of a given instanced static mesh component, matching existing instances by stable ids.   **/
+        /** InOutComponentInstanceIds holds the id of each instance currently in the component and is kept up to date. **/
+        static void UpdateInstancedStaticMeshComponentInstances(
+            USceneComponent * Component,
+            const TArray< FTransform > & InstancedTransforms,
+            const TArray< int32 > & InstanceIds,
+            TArray< int32 > & InOutComponentInstanceIds,
+            const FRotator & RotationOffset,
+            const FVector & ScaleOffset );
+
+        /** Replace all instances of a given instanced static mesh component in a single render and physics update. **/
+        static void ReplaceInstancedStaticMeshComponentInstances(
+            UInstancedStaticMeshComponent * InstancedStaticMeshComponent,
+            const TArray< FTransform > & InstancedTransforms );
+
+#if WITH_EDITOR
+
+        /** Replace the foliage instances owned by a given component with instances of a given mesh. Instance     **/
+        /** transforms are given in local space of the component. Passing a null mesh removes owned instances.    **/
+        static void UpdateFoliageInstances(
+            USceneComponent * BaseComponent,
+            UStaticMesh * StaticMesh,
+            UFoliageType_InstancedStaticMesh * DefaultSettings,
+            const TArray< FTransform > & InstancedTransforms,
+            const FRotator & RotationOffset,
+            const FVector & ScaleOffset );
+
+        /** Remove all foliage instances owned by a given component. **/
+        static void ClearFoliageInstances( USceneComponent * BaseComponent );
+
+#endif
+
         /** Retrieves list of asset names contained within the HDA. **/
         static bool GetAssetNames(
             UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & AssetLibraryId,
@@ -197,23 +234,47 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             bool bExportMaterials, bool bExportFullGeometry, bool bExportLighting, bool bExportNormalizedUVs,
             bool bExportTileUVs );
 
+        /** HAPI : Marshalling, extract landscape heights and paint layers as heightfield volumes and upload them.     **/
+        /** The volumes are merged into the returned asset, the ids of the volume assets are added to VolumeAssetIds.  **/
+        static bool HapiCreateAndConnectHeightfieldAsset(
+            HAPI_AssetId HostAssetId, int32 InputIndex, ALandscapeProxy * LandscapeProxy,
+            HAPI_AssetId & ConnectedAssetId, TArray< HAPI_AssetId > & VolumeAssetIds, bool bExportOnlySelected );
+
+        /** HAPI : Marshalling, re-upload the tiles of heightfield volumes covered by the given landscape components.  **/
+        /** Return false if the volumes no longer match the landscape and must be exported again.                    **/
+        static bool HapiUpdateHeightfieldAsset(
+            ALandscapeProxy * LandscapeProxy, const TArray< HAPI_AssetId > & VolumeAssetIds,
+            const TSet< TWeakObjectPtr< ULandscapeComponent > > & DirtyComponents );
+
         /** HAPI : Marshaling, extract geometry and create input asset form it. Connect to given host asset and return  **/
         /** new asset id.                                                                                               **/
         static bool HapiCreateAndConnectAsset(
             HAPI_AssetId HostAssetId, int32 InputIndex, UStaticMesh * Mesh,
             HAPI_AssetId & ConnectedAssetId );
 
+        /** HAPI : Marshaling, connect the input asset holding this static mesh to given host asset, the asset is     **/
+        /** shared by all inputs using the same mesh content and is only uploaded once. Return the input asset id.  **/
+        static bool HapiAcquireAndConnectStaticMeshAsset(
+            HAPI_AssetId HostAssetId, int32 InputIndex, UStaticMesh * StaticMesh,
+            HAPI_AssetId & ConnectedAssetId );
+
+        /** HAPI : Marshaling, release an input asset, it is destroyed once no other input uses it. **/
+        static bool HapiReleaseInputAsset( HAPI_AssetId AssetId );
+
         static bool HapiCreateAndConnectAsset(
             HAPI_AssetId HostAssetId, int32 InputIndex,
             TArray<UObject *>& InputObjects,
             HAPI_AssetId & ConnectedAssetId, TArray< HAPI_NodeId >& OutCreatedNodeIds );
 
-        /** HAPI : Marshaling, extract geometry and create input asset for it - return true on success **/
+        /** HAPI : Marshaling, extract geometry and create input asset for it - return true on success. If the merge   **/
+        /** asset is still valid, only actors without a valid input asset are exported. MergeInputAssetIds tracks the  **/
+        /** input asset connected to each slot of the merge asset.                                                     **/
         static bool HapiCreateAndConnectAsset(
             HAPI_AssetId HostAssetId,
             int32 InputIndex,
             TArray< FHoudiniAssetInputOutlinerMesh > & OutlinerMeshArray,
             HAPI_AssetId & ConnectedAssetId,
+            TArray< HAPI_AssetId > & MergeInputAssetIds,
             const float& SplineResolution = -1.0f);
 
         /** HAPI : Marshaling, extract points from the Unreal Spline and create an input curve for it - return true on success **/
@@ -298,6 +359,19 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const FHoudiniGeoPartObject & HoudiniGeoPartObject, const char * Name,
             HAPI_AttributeInfo & ResultAttributeInfo, TArray< int32 > & Data, int32 TupleSize = 0 );
 
+        /** HAPI : Get float attribute data for the valid wedges of a vertex list. The attribute is read in chunks    **/
+        /** which are scattered straight into the wedges, so only one chunk of the attribute is held at a time.     **/
+        static bool HapiGetVertexAttributeDataAsFloat(
+            HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId, HAPI_PartId PartId, const char * Name,
+            const TArray< int32 > & VertexList, HAPI_AttributeInfo & ResultAttributeInfo, TArray< float > & Data,
+            int32 TupleSize = 0 );
+
+        /** HAPI : Get integer attribute data for the valid faces of a vertex list, read in chunks like above. **/
+        static bool HapiGetFaceAttributeDataAsInteger(
+            HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId, HAPI_PartId PartId, const char * Name,
+            const TArray< int32 > & VertexList, HAPI_AttributeInfo & ResultAttributeInfo, TArray< int32 > & Data,
+            int32 TupleSize = 0 );
+
         /** HAPI : Get attribute data as string. **/
         static bool HapiGetAttributeDataAsString(
             HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId,
@@ -308,6 +382,25 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const FHoudiniGeoPartObject & HoudiniGeoPartObject, const char * Name,
             HAPI_AttributeInfo & ResultAttributeInfo, TArray< FString > & Data, int32 TupleSize = 0 );
 
+        /** HAPI : Get point positions directly as vectors. Positions are read in chunks straight into the vector   **/
+        /** array and converted in place, so no intermediate float buffer is needed.                                 **/
+        static bool HapiGetPointPositions(
+            HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId, HAPI_PartId PartId,
+            float ScaleFactor, bool bSwapYZ, TArray< FVector > & Positions );
+
+        /** HAPI : Get the vertex list of a part, read in chunks. **/
+        static bool HapiGetVertexList(
+            HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId, HAPI_PartId PartId,
+            int32 VertexCount, TArray< int32 > & VertexList );
+
+        /** HAPI : Get the string handles of a string attribute, read in chunks. **/
+        static bool HapiGetAttributeStringHandles(
+            HAPI_AssetId AssetId, HAPI_ObjectId ObjectId, HAPI_GeoId GeoId, HAPI_PartId PartId,
+            const char * Name, const HAPI_AttributeInfo & AttributeInfo, TArray< HAPI_StringHandle > & StringHandles );
+
+        /** Return how many elements of given size can be read in a single HAPI call within the marshalling budget. **/
+        static int32 GetMarshallingChunkElementCount( int32 ElementSize );
+
         /** HAPI : Get parameter data as float. **/
         static bool HapiGetParameterDataAsFloat(
             HAPI_NodeId NodeId, const std::string ParmName, float DefaultValue, float & Value );
@@ -419,6 +512,16 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             TArray< int32 > & NewVertexList, TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
             TArray< int32 > & AllCollisionFaceIndices );
 
+        /** Given vertex list and per face LOD indices, retrieve new vertex list for a specified LOD.                  **/
+        /** Return number of processed valid index vertices for this split.                                             **/
+        static int32 GetVertexListForLOD(
+            int32 LODIndex, const TArray< int32 > & FaceLODs, const TArray< int32 > & FullVertexList,
+            TArray< int32 > & NewVertexList, TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
+            TArray< int32 > & AllCollisionFaceIndices );
+
+        /** Return LOD index encoded in a LOD group name (lod0, lod1, ...) or INDEX_NONE if this is not a LOD group. **/
+        static int32 GetLODIndexFromGroupName( const FString & GroupName );
+
         /** HAPI : Retrieves the mesh sockets list for the current part							**/
         static int32 GetMeshSocketList(
             HAPI_NodeId AssetId, HAPI_NodeId ObjectId,
@@ -444,6 +547,20 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             FHoudiniGeoPartObject& HoudiniGeoPartObject,
             FKAggregateGeom& AggregateCollisionGeo );
 
+        /** Refresh navigation collision and physics state of static meshes whose collision has changed.        **/
+        /** All meshes are handled in a single pass over the static mesh components.                            **/
+        static void RefreshCollisionChanges( const TSet< UStaticMesh * > & StaticMeshes );
+
+        /** Compute the convex hull of a point cloud using quickhull and return the vertices of the hull.           **/
+        /** Points furthest from the hull are added first, MaxHullVertices stops the hull growth (0 means no limit).**/
+        static void ComputeConvexHull(
+            const TArray< FVector > & Points, int32 MaxHullVertices, TArray< FVector > & HullVertices );
+
+        /** Group the points referenced by a triangle vertex list into connected pieces.                           **/
+        /** Vertex list entries set to -1 are ignored. Return the number of pieces.                                 **/
+        static int32 GetConnectedPointPieces(
+            const TArray< int32 > & VertexList, int32 PointCount, TArray< TArray< int32 > > & PiecePointIndices );
+
         /** Create a package for given component for static mesh baking. **/
         static UPackage * BakeCreateStaticMeshPackageForComponent(
             UHoudiniAssetComponent * HoudiniAssetComponent,
@@ -452,6 +569,11 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
 
 #if WITH_EDITOR
 
+        /** Move a transient preview static mesh into its own intermediate package. Return true if it was moved. **/
+        static bool CreatePackageForTransientStaticMesh(
+            UHoudiniAssetComponent * HoudiniAssetComponent,
+            const FHoudiniGeoPartObject & HoudiniGeoPartObject, UStaticMesh * StaticMesh );
+
         /** Duplicate a given static mesh. This will create a new package for it. This will also create necessary       **/
         /** materials and textures and their corresponding packages. **/
         static UStaticMesh * DuplicateStaticMeshAndCreatePackage(
@@ -602,6 +724,22 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** Reset streams used by the given RawMesh. **/
         static void ResetRawMesh( FRawMesh & RawMesh );
 
+        /** Hash the content of a raw mesh and the materials of its static mesh. Positions are hashed exactly, or   **/
+        /** quantized relative to the first vertex, so that translated copies of the same geometry have the same   **/
+        /** hash. Quantized hashes only select candidates, see HaveSameRelativePositions.                           **/
+        static FSHAHash ComputeStaticMeshContentHash(
+            const FRawMesh & RawMesh, const UStaticMesh * StaticMesh, bool bQuantizePositions = true );
+
+        /** Return true if both position arrays describe the same geometry relative to their first vertex, up to   **/
+        /** the rounding of their translation.                                                                    **/
+        static bool HaveSameRelativePositions( const TArray< FVector > & Positions, const TArray< FVector > & OtherPositions );
+
+        /** Return true if both raw meshes provide the same wedge and face streams, and can be appended. **/
+        static bool HaveSameRawMeshStreams( const FRawMesh & RawMesh, const FRawMesh & OtherRawMesh );
+
+        /** Append the geometry of a raw mesh to another one, which provides the same streams. **/
+        static void AppendRawMesh( FRawMesh & RawMesh, const FRawMesh & OtherRawMesh );
+
 #endif // WITH_EDITOR
 
     public:
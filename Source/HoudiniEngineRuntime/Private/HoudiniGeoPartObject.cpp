@@ -388,8 +388,10 @@ FHoudiniGeoPartObject::operator==( const FHoudiniGeoPartObject & GeoPartObject )
 uint32
 FHoudiniGeoPartObject::GetTypeHash() const
 {
-    int32 HashBuffer[ 4 ] = { ObjectId, GeoId, PartId, SplitId };
-    return FCrc::MemCrc_DEPRECATED( (void *) &HashBuffer[ 0 ], sizeof( HashBuffer ) );
+    // Combine the integer ids directly, this is constant time and avoids running a crc over the key.
+    uint32 Hash = HashCombine( ::GetTypeHash( ObjectId ), ::GetTypeHash( GeoId ) );
+    Hash = HashCombine( Hash, ::GetTypeHash( PartId ) );
+    return HashCombine( Hash, ::GetTypeHash( SplitId ) );
 }
 
 void
@@ -583,15 +585,7 @@ FHoudiniGeoPartObject::HapiGetInstanceTransforms( HAPI_AssetId OtherAssetId, TAr
             ObjectId, GeoId, HAPI_SRT, &InstanceTransforms[ 0 ],
             0, PointCount) == HAPI_RESULT_SUCCESS )
         {
-            for ( int32 PointIdx = 0; PointIdx < PointCount; ++PointIdx )
-            {
-                FTransform TempTransformMatrix;
-
-                const HAPI_Transform & HapiInstanceTransform = InstanceTransforms[ PointIdx ];
-                FHoudiniEngineUtils::TranslateHapiTransform( HapiInstanceTransform, TempTransformMatrix );
-
-                AllTransforms.Add( TempTransformMatrix );
-            }
+            FHoudiniEngineUtils::TranslateHapiTransforms( InstanceTransforms, AllTransforms );
         }
         else
         {
@@ -1880,6 +1874,69 @@ FHoudiniGeoPartObject::HapiGetAttributeDataAsString(
     return HapiGetAttributeDataAsString( AssetId, AttributeName, ResultAttributeInfo, AttributeData, TupleSize );
 }
 
+bool
+FHoudiniGeoPartObject::HapiGetAttributeDataAsUniqueStrings(
+    HAPI_AssetId OtherAssetId, const char * AttributeName,
+    HAPI_AttributeOwner AttributeOwner, HAPI_AttributeInfo & ResultAttributeInfo,
+    TArray< FString > & UniqueValues, TArray< int32 > & ValueIndices ) const
+{
+    UniqueValues.Empty();
+    ValueIndices.SetNumUninitialized( 0 );
+
+    if ( !HapiGetAttributeInfo( OtherAssetId, AttributeName, AttributeOwner, ResultAttributeInfo ) )
+    {
+        ResultAttributeInfo.exists = false;
+        return false;
+    }
+
+    if ( !ResultAttributeInfo.exists )
+        return false;
+
+    TArray< HAPI_StringHandle > StringHandles;
+    if ( !FHoudiniEngineUtils::HapiGetAttributeStringHandles(
+        OtherAssetId, ObjectId, GeoId, PartId, AttributeName, ResultAttributeInfo, StringHandles ) )
+    {
+        ResultAttributeInfo.exists = false;
+        return false;
+    }
+
+    // Elements are bucketed by their integer handle, strings are only retrieved for new handles.
+    TMap< HAPI_StringHandle, int32 > HandleValueIndices;
+    TMap< FString, int32 > StringValueIndices;
+
+    ValueIndices.SetNumUninitialized( StringHandles.Num() );
+    for ( int32 Idx = 0, Num = StringHandles.Num(); Idx < Num; ++Idx )
+    {
+        const HAPI_StringHandle StringHandle = StringHandles[ Idx ];
+        if ( const int32 * FoundValueIdx = HandleValueIndices.Find( StringHandle ) )
+        {
+            ValueIndices[ Idx ] = *FoundValueIdx;
+            continue;
+        }
+
+        FString HapiString = TEXT( "" );
+        FHoudiniEngineString HoudiniEngineString( StringHandle );
+        HoudiniEngineString.ToFString( HapiString );
+
+        // Different handles may still refer to equal strings.
+        int32 ValueIdx = INDEX_NONE;
+        if ( const int32 * FoundValueIdx = StringValueIndices.Find( HapiString ) )
+        {
+            ValueIdx = *FoundValueIdx;
+        }
+        else
+        {
+            ValueIdx = UniqueValues.Add( HapiString );
+            StringValueIndices.Add( HapiString, ValueIdx );
+        }
+
+        HandleValueIndices.Add( StringHandle, ValueIdx );
+        ValueIndices[ Idx ] = ValueIdx;
+    }
+
+    return true;
+}
+
 bool
 FHoudiniGeoPartObject::HapiObjectGetUniqueInstancerMaterialId( HAPI_MaterialId & MaterialId ) const
 {
@@ -355,6 +355,13 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGeoPartObject
             const FString & AttributeName, HAPI_AttributeInfo & ResultAttributeInfo,
             TArray< FString > & AttributeData, int32 TupleSize = 0 ) const;
 
+        /** HAPI: Get attribute string data on a specified owner as unique values, along with the index of the value **/
+        /** used by each element. Each string handle is converted only once.                                          **/
+        bool HapiGetAttributeDataAsUniqueStrings(
+            HAPI_AssetId OtherAssetId, const char * AttributeName,
+            HAPI_AttributeOwner AttributeOwner, HAPI_AttributeInfo & ResultAttributeInfo,
+            TArray< FString > & UniqueValues, TArray< int32 > & ValueIndices ) const;
+
         /** HAPI: Get names of all attributes on all owners. **/
         bool HapiGetAllAttributeNames( HAPI_AssetId OtherAssetId, TArray< FString > & AttributeNames ) const;
         bool HapiGetAllAttributeNames( TArray< FString > & AttributeNames ) const;
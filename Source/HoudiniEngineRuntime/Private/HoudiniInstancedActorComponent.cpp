@@ -38,6 +38,7 @@
 UHoudiniInstancedActorComponent::UHoudiniInstancedActorComponent( const FObjectInitializer& ObjectInitializer )
 : Super( ObjectInitializer )
 , InstancedAsset( nullptr )
+, InstancesAsset( nullptr )
 {
 }
 
@@ -56,6 +57,10 @@ UHoudiniInstancedActorComponent::Serialize( FArchive & Ar )
 
     Ar << InstancedAsset;
     Ar << Instances;
+
+    // Loaded instances were spawned from the loaded asset.
+    if ( Ar.IsLoading() )
+        InstancesAsset = InstancedAsset;
 }
 
 void 
@@ -64,6 +69,7 @@ UHoudiniInstancedActorComponent::AddReferencedObjects( UObject * InThis, FRefere
     if ( UHoudiniInstancedActorComponent * This = Cast< UHoudiniInstancedActorComponent >( InThis ) )
     {
         Collector.AddReferencedObject( This->InstancedAsset, This );
+        Collector.AddReferencedObject( This->InstancesAsset, This );
         Collector.AddReferencedObjects( This->Instances, This );
     }
 }
@@ -74,16 +80,45 @@ UHoudiniInstancedActorComponent::SetInstances( const TArray<FTransform>& Instanc
 #if WITH_EDITOR
     if ( Instances.Num() || InstanceTransforms.Num() )
     {
-        const FScopedTransaction Transaction( LOCTEXT( "UpdateInstances", "Update Instances" ) );
+        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+        bool bTransactUpdates = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bTransactInstancedActorUpdates;
+
+        const FScopedTransaction Transaction( LOCTEXT( "UpdateInstances", "Update Instances" ), bTransactUpdates );
         GetOwner()->Modify();
-        ClearInstances();
+
+        // Actors spawned from another asset can't be reused, and actors may have been deleted by the user.
+        if ( InstancesAsset != InstancedAsset || !InstancedAsset )
+            ClearInstances();
+
+        Instances.RemoveAll( []( AActor * Instance ) { return !Instance || Instance->IsPendingKill(); } );
 
         if( InstancedAsset )
         {
-            for( const FTransform& InstanceTransform : InstanceTransforms )
+            // Existing actors are moved, only the difference in count is spawned or destroyed.
+            const int32 ReusedInstanceCount = FMath::Min( Instances.Num(), InstanceTransforms.Num() );
+            for ( int32 InstanceIdx = 0; InstanceIdx < ReusedInstanceCount; ++InstanceIdx )
             {
-                AddInstance( InstanceTransform );
+                AActor * Instance = Instances[ InstanceIdx ];
+                const FTransform & InstanceTransform = InstanceTransforms[ InstanceIdx ];
+
+                USceneComponent * InstanceRootComponent = Instance->GetRootComponent();
+                if ( InstanceRootComponent && InstanceRootComponent->GetRelativeTransform().Equals( InstanceTransform ) )
+                    continue;
+
+                if ( bTransactUpdates )
+                    Instance->Modify();
+
+                Instance->SetActorRelativeTransform( InstanceTransform );
             }
+
+            for ( int32 InstanceIdx = Instances.Num() - 1; InstanceIdx >= InstanceTransforms.Num(); --InstanceIdx )
+            {
+                Instances[ InstanceIdx ]->Destroy();
+                Instances.RemoveAt( InstanceIdx, 1, false );
+            }
+
+            for ( int32 InstanceIdx = Instances.Num(); InstanceIdx < InstanceTransforms.Num(); ++InstanceIdx )
+                AddInstance( InstanceTransforms[ InstanceIdx ] );
         }
         else
         {
@@ -100,6 +135,7 @@ UHoudiniInstancedActorComponent::AddInstance( const FTransform& InstanceTransfor
     {
         NewActor->AttachToComponent( this, FAttachmentTransformRules::KeepRelativeTransform );
         NewActor->SetActorRelativeTransform( InstanceTransform );
+        InstancesAsset = InstancedAsset;
         return Instances.Add( NewActor );
     }
     return -1;
@@ -129,6 +165,7 @@ UHoudiniInstancedActorComponent::ClearInstances()
         }
     }
     Instances.Empty();
+    InstancesAsset = nullptr;
 }
 
 
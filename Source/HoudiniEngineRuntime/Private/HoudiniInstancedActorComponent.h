@@ -63,4 +63,9 @@ public:
     UPROPERTY( SkipSerialization, VisibleInstanceOnly, Category = Instances )
     TArray< AActor* > Instances;
 
+protected:
+
+    /** Asset the current instances were spawned from, instances of another asset can't be reused. */
+    UObject* InstancesAsset;
+
 };
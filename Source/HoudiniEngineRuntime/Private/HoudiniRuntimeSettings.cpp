@@ -53,6 +53,14 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
     bTransformChangeTriggersCooks = false;
     bDisplaySlateCookingNotifications = true;
     bCookCurvesOnMouseRelease = false;
+    bCreateTransientPreviewMeshes = false;
+    bShareIdenticalGeoParts = false;
+    bMergeSmallGeoParts = false;
+    SmallGeoPartTriangleThreshold = 128;
+    ComponentCreationBudgetMs = 0.0f;
+    bUseHierarchicalInstancing = false;
+    bTransactInstancedActorUpdates = false;
+    bOutputInstancersToFoliage = false;
 
     /** Parameter options. **/
     bTreatRampParametersAsMultiparms = false;
@@ -64,6 +72,9 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
     UCXRenderedCollisionGroupNamePrefix = TEXT( HAPI_UNREAL_GROUP_GEOMETRY_RENDERED_COLLISION_UCX );
     SimpleCollisionGroupNamePrefix = TEXT( HAPI_UNREAL_GROUP_GEOMETRY_SIMPLE_COLLISION );
     SimpleRenderedCollisionGroupNamePrefix = TEXT( HAPI_UNREAL_GROUP_GEOMETRY_SIMPLE_RENDERED_COLLISION );
+    bDeferCollisionNavigationRebuild = false;
+    bSplitUCXCollisionByConnectivity = false;
+    UCXCollisionMaxHullVertices = 0;
 
     /** Geometry marshalling. **/
     MarshallingAttributeMaterial = TEXT( HAPI_UNREAL_ATTRIB_MATERIAL );
@@ -74,6 +85,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
     MarshallingAttributeGeneratedMeshName = TEXT( HAPI_UNREAL_ATTRIB_GENERATED_MESH_NAME );
     MarshallingAttributeInputMeshName = TEXT( HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME );
     MarshallingSplineResolution = HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT;
+    MarshallingChunkSizeMB = 64;
 
     /** Geometry scaling. **/
     GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
@@ -101,6 +113,8 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
     RecomputeNormalsFlag = HRSRF_OnlyIfMissing;
     RecomputeTangentsFlag = HRSRF_OnlyIfMissing;
     bUseMikkTSpace = true;
+    bUsePreviewMeshBuild = false;
+    PreviewMeshFullBuildDelay = 2.0f;
 
     /** Custom Houdini location. **/
     bUseCustomHoudiniLocation = false;
@@ -240,6 +254,16 @@ UHoudiniRuntimeSettings::PostEditChangeProperty( struct FPropertyChangedEvent &
     }
     else if (Property->GetName() == TEXT("MarshallingSplineResolution"))
 	MarshallingSplineResolution = FMath::Clamp(MarshallingSplineResolution, 0.0f, 10000.0f);
+    else if ( Property->GetName() == TEXT( "MarshallingChunkSizeMB" ) )
+        MarshallingChunkSizeMB = FMath::Max( MarshallingChunkSizeMB, 0 );
+    else if ( Property->GetName() == TEXT( "PreviewMeshFullBuildDelay" ) )
+        PreviewMeshFullBuildDelay = FMath::Max( PreviewMeshFullBuildDelay, 0.0f );
+    else if ( Property->GetName() == TEXT( "SmallGeoPartTriangleThreshold" ) )
+        SmallGeoPartTriangleThreshold = FMath::Max( SmallGeoPartTriangleThreshold, 1 );
+    else if ( Property->GetName() == TEXT( "ComponentCreationBudgetMs" ) )
+        ComponentCreationBudgetMs = FMath::Max( ComponentCreationBudgetMs, 0.0f );
+    else if ( Property->GetName() == TEXT( "UCXCollisionMaxHullVertices" ) )
+        UCXCollisionMaxHullVertices = ( UCXCollisionMaxHullVertices <= 0 ) ? 0 : FMath::Clamp( UCXCollisionMaxHullVertices, 4, 255 );
 
     /*
     if ( Property->GetName() == TEXT( "bEnableCooking" ) )
@@ -364,6 +388,15 @@ UHoudiniRuntimeSettings::SetMeshBuildSettings( FMeshBuildSettings & MeshBuildSet
     }
 }
 
+void
+UHoudiniRuntimeSettings::SetPreviewMeshBuildSettings( FMeshBuildSettings & MeshBuildSettings ) const
+{
+    MeshBuildSettings.bGenerateLightmapUVs = false;
+    MeshBuildSettings.bUseMikkTSpace = false;
+    MeshBuildSettings.bUseFullPrecisionUVs = false;
+    MeshBuildSettings.DistanceFieldResolutionScale = 0.0f;
+}
+
 void
 UHoudiniRuntimeSettings::UpdateSessionUi()
 {
@@ -124,6 +124,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         /** Fill static mesh build settings structure based on assigned settings. **/
         void SetMeshBuildSettings( FMeshBuildSettings & MeshBuildSettings, FRawMesh & RawMesh ) const;
 
+        /** Disable the costly parts of a static mesh build, used for meshes built while cooking interactively. **/
+        void SetPreviewMeshBuildSettings( FMeshBuildSettings & MeshBuildSettings ) const;
+
 #endif // WITH_EDITOR
 
     public:
@@ -183,6 +186,45 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
         bool bCookCurvesOnMouseRelease;
 
+        // Generated meshes are created as transient previews while editing, they are only saved with the
+        // level, without packages of their own.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bCreateTransientPreviewMeshes;
+
+        // Parts with identical geometry, up to a translation, share a single generated mesh and are rendered by
+        // a single instanced static mesh component.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bShareIdenticalGeoParts;
+
+        // Parts with fewer triangles than the threshold are merged into a single mesh per object and material.
+        // Can be overridden per part with the unreal_merge_small_parts detail attribute.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bMergeSmallGeoParts;
+
+        // Parts with fewer triangles than this are merged, when merging small parts is enabled.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        int32 SmallGeoPartTriangleThreshold;
+
+        // Per frame budget, in milliseconds, for creating the components of cooked output. Components which do not
+        // fit in the budget are created on the following frames. Zero creates all components at once.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        float ComponentCreationBudgetMs;
+
+        // Instancers create hierarchical instanced static mesh components, which cull and LOD instances per cluster.
+        // Can be overridden per instancer with the unreal_hierarchical_instancing detail attribute.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bUseHierarchicalInstancing;
+
+        // Record the actors spawned, moved and destroyed by actor instancers in the undo buffer. Instanced actors are
+        // reused across cooks, recording them can make each cook slow and the undo buffer large.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bTransactInstancedActorUpdates;
+
+        // Static mesh instancers write their instances into the level's foliage instead of instanced components.
+        // Can be overridden per instancer with the unreal_foliage detail attribute.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bOutputInstancersToFoliage;
+
     /** Parameter options. **/
     public:
 
@@ -219,6 +261,19 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY( GlobalConfig, EditAnywhere, Category = CollisionGeneration)
         FString SimpleRenderedCollisionGroupNamePrefix;
 
+        // Delays the rebuild of navigation collision, physics state and navmesh data of generated meshes until
+        // the asset is idle, instead of doing it after every cook. Useful when editing collision heavy assets.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = CollisionGeneration )
+        bool bDeferCollisionNavigationRebuild;
+
+        // Generates one UCX convex hull per connected piece of geometry instead of one per UCX group.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = CollisionGeneration )
+        bool bSplitUCXCollisionByConnectivity;
+
+        // Maximum number of vertices of each generated UCX convex hull, 0 means no limit.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = CollisionGeneration )
+        int32 UCXCollisionMaxHullVertices;
+
     /** Geometry marshalling. **/
     public:
 
@@ -254,6 +309,11 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
         float MarshallingSplineResolution;
 
+        // Maximum amount of data, in megabytes, read from Houdini Engine by a single attribute or vertex list request.
+        // Larger data is read in several chunks, which bounds the transient memory used by each transfer. 0 disables chunking.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = GeometryMarshalling )
+        int32 MarshallingChunkSizeMB;
+
     /** Geometry scaling. **/
     public:
 
@@ -383,6 +443,15 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY( GlobalConfig, EditAnywhere, Category = StaticMeshBuildSettings )
         bool bUseMikkTSpace;
 
+        // If true, new Houdini Assets build their meshes without lightmap UVs, distance fields and Mikk T Space
+        // tangents while cooking. Meshes are rebuilt with the full settings once the asset is idle, saved or baked.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = StaticMeshBuildSettings )
+        bool bUsePreviewMeshBuild;
+
+        // Time in seconds without cooking after which preview meshes get their full build.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = StaticMeshBuildSettings )
+        float PreviewMeshFullBuildDelay;
+
     /** Custom Houdini location. **/
     public:
 